@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics.hpp>
+
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+/// Run a kernel over the image several times and print
+/// the number of pixels it processes per second
+///
+////////////////////////////////////////////////////////////
+void measure(const char* name, const std::function<void()>& kernel, sf::Vector2u size, int iterations)
+{
+    // Warm up the caches and the page mappings of the image
+    kernel();
+
+    const sf::Clock clock;
+    for (int i = 0; i < iterations; ++i)
+        kernel();
+    const auto seconds = static_cast<double>(clock.getElapsedTime().asSeconds());
+
+    const double pixels = static_cast<double>(size.x) * size.y * iterations;
+    std::cout << "  " << std::setw(22) << std::left << name << std::right << std::setw(10) << pixels / seconds / 1e6
+              << " Mpixels/s\n";
+}
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Entry point of application
+///
+/// \return Application exit code
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    // A 4K image, with random colors and alpha values where a fifth
+    // of the pixels are transparent and a fifth are opaque
+    const sf::Vector2u size(3840, 2160);
+    constexpr int      iterations = 20;
+
+    std::vector<std::uint8_t>          pixels(std::size_t{size.x} * size.y * 4);
+    std::minstd_rand                   random(42);
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::uniform_int_distribution<int> kind(0, 4);
+    for (std::size_t i = 0; i < pixels.size(); i += 4)
+    {
+        const int alpha = kind(random);
+        pixels[i + 0]   = static_cast<std::uint8_t>(byte(random));
+        pixels[i + 1]   = static_cast<std::uint8_t>(byte(random));
+        pixels[i + 2]   = static_cast<std::uint8_t>(byte(random));
+        pixels[i + 3]   = static_cast<std::uint8_t>(alpha == 0 ? 0 : alpha == 1 ? 255 : byte(random));
+    }
+
+    sf::Image       image(size, pixels.data());
+    const sf::Image source(size, pixels.data());
+    const sf::Color maskColor(image.getPixel({0, 0}));
+
+    std::cout << "Processing a " << size.x << "x" << size.y << " image, " << iterations << " times per kernel\n";
+    std::cout << std::fixed << std::setprecision(1);
+
+    measure("createMaskFromColor", [&] { image.createMaskFromColor(maskColor); }, size, iterations);
+    measure("flipHorizontally", [&] { image.flipHorizontally(); }, size, iterations);
+    measure("flipVertically", [&] { image.flipVertically(); }, size, iterations);
+    measure("copy", [&] { (void)image.copy(source, {0, 0}); }, size, iterations);
+    measure("copy (applyAlpha)", [&] { (void)image.copy(source, {0, 0}, {}, true); }, size, iterations);
+}
@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics.hpp>
+
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+/// Upload a region of the source pixels to the texture
+/// several times and return the number of uploads per second
+///
+/// The pixels are copied out of the source array before
+/// glTexSubImage2D returns, so the time spent on the CPU
+/// is the actual cost of the upload for the caller.
+///
+////////////////////////////////////////////////////////////
+double measure(sf::Texture&                     texture,
+               const std::vector<std::uint8_t>& pixels,
+               unsigned int                     stride,
+               sf::Vector2u                     region,
+               bool                             perRow,
+               int                              iterations)
+{
+    const sf::Clock clock;
+    for (int i = 0; i < iterations; ++i)
+    {
+        if (perRow)
+        {
+            // What uploading a cropped area cost before strided uploads: one call per row
+            for (unsigned int y = 0; y < region.y; ++y)
+                texture.update(pixels.data() + std::size_t{y} * stride * 4, {region.x, 1}, {0, y});
+        }
+        else
+        {
+            texture.update(pixels.data(), region, {0, 0}, stride);
+        }
+    }
+
+    return static_cast<double>(iterations) / static_cast<double>(clock.getElapsedTime().asSeconds());
+}
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Entry point of application
+///
+/// \return Application exit code
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    // Crop a 1024x4096 region out of a 4096x4096 image
+    constexpr unsigned int stride = 4096;
+    const sf::Vector2u     region(1024, 4096);
+    constexpr int          iterations = 50;
+
+    std::vector<std::uint8_t> pixels(std::size_t{stride} * region.y * 4);
+    for (std::size_t i = 0; i < pixels.size(); ++i)
+        pixels[i] = static_cast<std::uint8_t>(i * 7);
+
+    sf::Texture texture(region);
+
+    // Upload once before timing, so that the driver allocates the storage of the texture
+    texture.update(pixels.data(), region, {0, 0}, stride);
+
+    std::cout << "Uploading a " << region.x << "x" << region.y << " region of a " << stride << " pixels wide image, "
+              << iterations << " times per test\n";
+    std::cout << std::fixed << std::setprecision(1);
+
+    const double megabytes = static_cast<double>(region.x) * region.y * 4 / (1024 * 1024);
+    for (const bool perRow : {true, false})
+    {
+        const double uploadsPerSecond = measure(texture, pixels, stride, region, perRow, iterations);
+        std::cout << "  " << std::setw(11) << std::left << (perRow ? "per row" : "single call") << std::right
+                  << std::setw(8) << uploadsPerSecond << " uploads/s, " << std::setw(8)
+                  << uploadsPerSecond * megabytes << " MiB/s\n";
+    }
+}
@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network.hpp>
+
+#include <SFML/System/Clock.hpp>
+
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+
+#include <cstddef>
+
+
+namespace
+{
+constexpr std::size_t batchSize    = 64;
+constexpr std::size_t datagramSize = 100;
+
+using Payloads = std::array<std::array<std::byte, datagramSize>, batchSize>;
+
+
+////////////////////////////////////////////////////////////
+/// Send a batch of datagrams to the receiver and read them
+/// back, one call per datagram
+///
+////////////////////////////////////////////////////////////
+bool exchangeSingle(sf::UdpSocket& sender, sf::UdpSocket& receiver, const Payloads& outgoing, Payloads& incoming)
+{
+    for (const auto& payload : outgoing)
+    {
+        if (sender.send(payload.data(), payload.size(), sf::IpAddress::LocalHost, receiver.getLocalPort()) !=
+            sf::Socket::Status::Done)
+            return false;
+    }
+
+    for (auto& payload : incoming)
+    {
+        std::size_t                  received = 0;
+        std::optional<sf::IpAddress> remoteAddress;
+        unsigned short               remotePort = 0;
+        if (receiver.receive(payload.data(), payload.size(), received, remoteAddress, remotePort) !=
+            sf::Socket::Status::Done)
+            return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Send a batch of datagrams to the receiver and read them
+/// back, with the batched overloads
+///
+////////////////////////////////////////////////////////////
+bool exchangeBatched(sf::UdpSocket& sender, sf::UdpSocket& receiver, const Payloads& outgoing, Payloads& incoming)
+{
+    std::array<sf::UdpSocket::OutgoingDatagram, batchSize> outgoingDatagrams;
+    std::array<sf::UdpSocket::IncomingDatagram, batchSize> incomingDatagrams;
+    for (std::size_t i = 0; i < batchSize; ++i)
+    {
+        outgoingDatagrams[i].data          = outgoing[i].data();
+        outgoingDatagrams[i].size          = outgoing[i].size();
+        outgoingDatagrams[i].remoteAddress = sf::IpAddress::LocalHost;
+        outgoingDatagrams[i].remotePort    = receiver.getLocalPort();
+        incomingDatagrams[i].data          = incoming[i].data();
+        incomingDatagrams[i].size          = incoming[i].size();
+    }
+
+    std::size_t sent = 0;
+    if (sender.send(outgoingDatagrams.data(), batchSize, sent) != sf::Socket::Status::Done)
+        return false;
+
+    // A batch receive returns the datagrams that are already queued, which may not be all of them yet
+    std::size_t total = 0;
+    while (total < batchSize)
+    {
+        std::size_t received = 0;
+        if (receiver.receive(incomingDatagrams.data() + total, batchSize - total, received) != sf::Socket::Status::Done)
+            return false;
+        total += received;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Exchange batches of datagrams over the loopback interface
+/// for a second and return the number of datagrams per second
+///
+////////////////////////////////////////////////////////////
+double measure(bool batched)
+{
+    sf::UdpSocket sender;
+    sf::UdpSocket receiver;
+    if (receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) != sf::Socket::Status::Done)
+    {
+        std::cerr << "Failed to bind the receiving socket" << std::endl;
+        return 0.0;
+    }
+
+    Payloads outgoing{};
+    Payloads incoming{};
+
+    const sf::Clock clock;
+    std::size_t     datagrams = 0;
+    while (clock.getElapsedTime() < sf::seconds(1))
+    {
+        const bool success = batched ? exchangeBatched(sender, receiver, outgoing, incoming)
+                                     : exchangeSingle(sender, receiver, outgoing, incoming);
+        if (!success)
+        {
+            std::cerr << "Failed to exchange the datagrams" << std::endl;
+            return 0.0;
+        }
+
+        datagrams += batchSize;
+    }
+
+    return static_cast<double>(datagrams) / static_cast<double>(clock.getElapsedTime().asSeconds());
+}
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Entry point of application
+///
+/// \return Application exit code
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    std::cout << "Exchanging " << batchSize << " datagrams of " << datagramSize
+              << " bytes per round over the loopback interface, for one second per test\n";
+    std::cout << std::fixed << std::setprecision(0);
+
+    for (const bool batched : {false, true})
+    {
+        std::cout << "  " << std::setw(8) << std::left << (batched ? "batched" : "single") << std::right
+                  << std::setw(10) << measure(batched) << " datagrams/s\n";
+    }
+}
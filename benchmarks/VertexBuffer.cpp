@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics.hpp>
+
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+/// Rewrite part of the vertices of the buffer and draw it,
+/// once per frame, and return the number of frames per second
+///
+////////////////////////////////////////////////////////////
+double measure(sf::VertexBuffer::Usage usage, std::vector<sf::Vertex>& vertices, std::size_t updateCount, int frames)
+{
+    sf::RenderTexture renderTexture({64, 64});
+
+    sf::VertexBuffer vertexBuffer(sf::PrimitiveType::Triangles, usage);
+    if (!vertexBuffer.create(vertices.size()) || !vertexBuffer.update(vertices.data()))
+    {
+        std::cerr << "Failed to create the vertex buffer" << std::endl;
+        return 0.0;
+    }
+
+    const sf::Clock clock;
+    std::size_t     offset = 0;
+    for (int frame = 0; frame < frames; ++frame)
+    {
+        // Move the vertices to update, so that the data really changes every frame
+        for (std::size_t i = offset; i < offset + updateCount; ++i)
+            vertices[i].position.x = static_cast<float>((frame + static_cast<int>(i)) % 64);
+
+        if (!vertexBuffer.update(vertices.data() + offset, updateCount, static_cast<unsigned int>(offset)))
+        {
+            std::cerr << "Failed to update the vertex buffer" << std::endl;
+            return 0.0;
+        }
+
+        renderTexture.clear();
+        renderTexture.draw(vertexBuffer);
+        renderTexture.display();
+
+        offset = (offset + updateCount) % vertices.size();
+    }
+
+    // Reading the pixels back waits for the GPU to finish drawing every frame
+    (void)renderTexture.getTexture().copyToImage();
+
+    return static_cast<double>(frames) / static_cast<double>(clock.getElapsedTime().asSeconds());
+}
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Entry point of application
+///
+/// \return Application exit code
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    constexpr std::size_t vertexCount = 6 * 50'000;
+    constexpr int         frames      = 500;
+
+    // Small triangles, so that the cost of the updates isn't hidden by the fill rate
+    std::vector<sf::Vertex> vertices(vertexCount);
+    for (std::size_t i = 0; i < vertexCount; ++i)
+    {
+        constexpr std::array<sf::Vector2f, 6> corners{{{0, 0}, {1, 0}, {0, 1}, {0, 1}, {1, 0}, {1, 1}}};
+        vertices[i].position = corners[i % 6];
+        vertices[i].color    = sf::Color::White;
+    }
+
+    // Dynamic buffers are updated with glBufferSubData, stream buffers are orphaned and written unsynchronized
+    struct Mode
+    {
+        const char*             name;
+        sf::VertexBuffer::Usage usage;
+    };
+    constexpr std::array<Mode, 2> modes{{{"dynamic", sf::VertexBuffer::Usage::Dynamic},
+                                         {"stream", sf::VertexBuffer::Usage::Stream}}};
+
+    std::cout << "Updating and drawing " << vertexCount << " vertices, " << frames << " frames per test\n";
+    std::cout << std::fixed << std::setprecision(1);
+    for (const std::size_t updateCount : {vertexCount, vertexCount / 4})
+    {
+        std::cout << (updateCount == vertexCount ? "Full updates:\n" : "Partial updates (1/4 of the buffer):\n");
+        for (const Mode& mode : modes)
+        {
+            const double framesPerSecond = measure(mode.usage, vertices, updateCount, frames);
+            std::cout << "  " << std::setw(8) << mode.name << ": " << framesPerSecond << " frames/s, "
+                      << (framesPerSecond > 0.0 ? 1000.0 / framesPerSecond : 0.0) << " ms/frame\n";
+        }
+    }
+}
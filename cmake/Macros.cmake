@@ -320,6 +320,19 @@ macro(sfml_add_example target)
     endif()
 endmacro()
 
+# add a new target which is a SFML benchmark
+# example: sfml_add_benchmark(sfml-benchmark-image
+#                             SOURCES Image.cpp
+#                             DEPENDS SFML::Graphics)
+macro(sfml_add_benchmark target)
+
+    # benchmarks are command line programs built like the examples
+    sfml_add_example(${target} ${ARGN})
+
+    # set the target's folder (for IDEs that support it, e.g. Visual Studio)
+    set_target_properties(${target} PROPERTIES FOLDER "Benchmarks")
+endmacro()
+
 # add a new target which is a SFML test
 # example: sfml_add_test(sfml-test
 #                           ftp.cpp ...
@@ -37,6 +37,7 @@
 
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -72,6 +73,51 @@ public:
         std::string family; //!< The font family
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics about the texture holding the glyphs of a character size
+    ///
+    /// \see `getAtlasStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct AtlasStatistics
+    {
+        Vector2u    textureSize;  //!< Current size of the texture, in pixels
+        std::size_t glyphCount{}; //!< Number of glyphs stored in the texture
+        float       occupancy{};  //!< Fraction of the texture area covered by glyphs, in [0, 1]
+        std::size_t evictions{};  //!< Number of glyphs evicted so far to make room for new ones
+        std::size_t regrowths{};  //!< Number of times the texture was enlarged so far
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Range of Unicode code points
+    ///
+    /// \see `preload`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct CodePointRange
+    {
+        std::uint32_t first{}; //!< First code point of the range
+        std::uint32_t last{};  //!< Last code point of the range (included)
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Variant of the glyphs to load
+    ///
+    /// \see `preload`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct GlyphStyle
+    {
+        bool  bold{};             //!< Load the bold version of the glyphs?
+        float outlineThickness{}; //!< Thickness of the outline of the glyphs
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Distance field parameters
+    ////////////////////////////////////////////////////////////
+    static constexpr unsigned int DistanceFieldCharacterSize{64}; //!< Size at which distance fields are rasterized
+    static constexpr unsigned int DistanceFieldSpread{8};         //!< Distance to the edges covered by the fields
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -229,6 +275,17 @@ public:
     /// Be aware that using a negative value for the outline
     /// thickness will cause distorted rendering.
     ///
+    /// When distance field glyphs are enabled, the outline
+    /// thickness is ignored: outlines are rendered by `sf::Text`
+    /// from the same distance field as the glyph itself.
+    ///
+    /// The returned reference remains valid as long as the glyph
+    /// pages of the font are not reset. When the texture is full,
+    /// the glyph may be evicted to make room for new ones, or
+    /// moved within the texture: its texture rectangle is then
+    /// updated in place, and is only valid again once the glyph
+    /// is requested again.
+    ///
     /// \param codePoint        Unicode code point of the character to get
     /// \param characterSize    Reference character size
     /// \param bold             Retrieve the bold version or the regular one?
@@ -361,26 +418,216 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isSmooth() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum size of the glyph textures
+    ///
+    /// The texture holding the glyphs of a character size starts
+    /// small and is enlarged as more glyphs are loaded. Once it
+    /// cannot grow anymore, the least recently used glyphs are
+    /// evicted to make room for the new ones.
+    ///
+    /// Limiting the texture size bounds the memory used by fonts
+    /// in long-running programs that display many different
+    /// characters. The default value of 0 means that the texture
+    /// can grow up to `Texture::getMaximumSize()`.
+    ///
+    /// Glyphs are not moved while render targets of other threads
+    /// have batched draws pending with the texture (see
+    /// `RenderTarget::setBatchingEnabled`). The texture then grows
+    /// past the maximum size instead of evicting glyphs.
+    ///
+    /// The glyphs kept by an eviction are moved within a copy of
+    /// the texture pixels in system memory, so that the texture
+    /// isn't read back each time. That copy is created by the
+    /// first eviction and kept with the texture from then on,
+    /// which doubles the memory that the texture uses.
+    ///
+    /// \param size Maximum width and height of the textures, in pixels, or 0 for no limit
+    ///
+    /// \see `getMaximumTextureSize`, `getAtlasStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaximumTextureSize(unsigned int size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum size of the glyph textures
+    ///
+    /// \return Maximum width and height of the textures, in pixels, or 0 if there is no limit
+    ///
+    /// \see `setMaximumTextureSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getMaximumTextureSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the shared glyph texture
+    ///
+    /// By default, the glyphs of each character size are stored
+    /// in their own texture. When the shared texture is enabled,
+    /// the glyphs of all character sizes, styles and outline
+    /// thicknesses are packed together into a single texture,
+    /// so that texts of different sizes using this font can be
+    /// drawn with the same texture bound.
+    ///
+    /// Changing this setting forgets all the glyphs loaded so
+    /// far, and invalidates the references returned by `getGlyph`
+    /// and `getTexture`.
+    ///
+    /// \param shared `true` to share a single texture between all character sizes, `false` to use one per size
+    ///
+    /// \see `isAtlasShared`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAtlasShared(bool shared);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the glyphs of all character sizes share a single texture
+    ///
+    /// \return `true` if the texture is shared, `false` if each character size has its own
+    ///
+    /// \see `setAtlasShared`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isAtlasShared() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable distance field glyphs
+    ///
+    /// By default, glyphs are rasterized for every character
+    /// size they are requested at. When distance field glyphs
+    /// are enabled, each glyph is rasterized only once, at
+    /// `DistanceFieldCharacterSize`, and the texture stores the
+    /// signed distance from each pixel to the glyph's edges
+    /// instead of its coverage. Glyphs of all character sizes,
+    /// styles and outline thicknesses then share this single
+    /// field, whose metrics are scaled to the requested size.
+    ///
+    /// The alpha channel of the texture holds the distance,
+    /// mapped so that 0.5 is on the glyph's edge and 0 and 1
+    /// are `DistanceFieldSpread` pixels outside and inside it.
+    /// `sf::Text` renders such glyphs with a dedicated shader,
+    /// so that they stay sharp at any scale and their outline
+    /// is derived from the field. The outline can therefore
+    /// not be thicker than `DistanceFieldSpread` pixels at the
+    /// reference size. Distance fields should be used with the
+    /// smooth filter enabled.
+    ///
+    /// Changing this setting forgets all the glyphs loaded so
+    /// far, and invalidates the references returned by `getGlyph`
+    /// and `getTexture`.
+    ///
+    /// \param enabled `true` to use distance field glyphs, `false` to use coverage glyphs
+    ///
+    /// \see `isDistanceFieldEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDistanceFieldEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether distance field glyphs are enabled
+    ///
+    /// \return `true` if the glyphs are distance fields, `false` otherwise
+    ///
+    /// \see `setDistanceFieldEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isDistanceFieldEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get statistics about the texture holding the glyphs of a character size
+    ///
+    /// When the texture is shared, the statistics cover the
+    /// glyphs of all character sizes. If no glyph of the size
+    /// was loaded yet, the statistics are all zero.
+    ///
+    /// \param characterSize Reference character size
+    ///
+    /// \return Statistics about the texture of the requested size
+    ///
+    /// \see `setMaximumTextureSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] AtlasStatistics getAtlasStatistics(unsigned int characterSize) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load glyphs in advance, rasterizing them in parallel
+    ///
+    /// Requesting a glyph that has not been loaded yet with
+    /// `getGlyph` rasterizes it on the spot, which can make the
+    /// first frame showing new text noticeably slower. This
+    /// function loads all the glyphs of the given code point
+    /// ranges, character sizes and styles ahead of time.
+    ///
+    /// The glyphs are rasterized on worker threads, each one
+    /// using its own instance of the font, then packed by the
+    /// calling thread, which updates the area of each texture
+    /// that received new glyphs with a single call. To do so, the
+    /// pixels of the textures that have no copy in system memory
+    /// (see `setMaximumTextureSize`) are read back and copied for
+    /// the duration of the call. Fonts opened
+    /// from a stream cannot be instantiated again, so their
+    /// glyphs are rasterized on the calling thread.
+    ///
+    /// Glyphs that are already loaded are skipped, as well as
+    /// the whole request when no font is loaded. Since the font
+    /// textures are updated, this function must be called from
+    /// a thread that can use OpenGL, like `getGlyph`.
+    ///
+    /// \param ranges         Ranges of Unicode code points of the characters to load
+    /// \param characterSizes Character sizes to load the glyphs at
+    /// \param styles         Variants of the glyphs to load (regular glyphs only if empty)
+    ///
+    /// \return Number of glyphs that were rasterized
+    ///
+    /// \see `getGlyph`
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t preload(const std::vector<CodePointRange>& ranges,
+                        const std::vector<unsigned int>&   characterSizes,
+                        const std::vector<GlyphStyle>&     styles = {});
+
 private:
+    friend class Text;
+
     ////////////////////////////////////////////////////////////
-    /// \brief Structure defining a row of glyphs
+    /// \brief Segment of the top edge of the glyphs packed in a texture
     ///
     ////////////////////////////////////////////////////////////
-    struct Row
+    struct SkylineNode
     {
-        Row(unsigned int rowTop, unsigned int rowHeight) : top(rowTop), height(rowHeight)
-        {
-        }
+        unsigned int x{};     //!< X position of the left end of the segment
+        unsigned int y{};     //!< Y position of the segment
+        unsigned int width{}; //!< Width of the segment
+    };
 
-        unsigned int width{}; //!< Current width of the row
-        unsigned int top;     //!< Y position of the row into the texture
-        unsigned int height;  //!< Height of the row
+    ////////////////////////////////////////////////////////////
+    /// \brief Glyph stored in the cache of a page
+    ///
+    ////////////////////////////////////////////////////////////
+    struct CachedGlyph
+    {
+        Glyph         glyph;     //!< The glyph
+        std::uint64_t lastUse{}; //!< Value of the page use counter when the glyph was last requested
+        bool          evicted{}; //!< Was the glyph evicted from the texture? It is loaded again when requested
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pixels and metrics of a glyph, before it is stored in a texture
+    ///
+    ////////////////////////////////////////////////////////////
+    struct RasterizedGlyph
+    {
+        Glyph                     glyph;  //!< Metrics of the glyph (its texture rectangle is not set yet)
+        Vector2u                  size;   //!< Size of the pixels, including the padding
+        std::vector<std::uint8_t> pixels; //!< RGBA pixels of the glyph, including the padding
     };
 
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
-    using GlyphTable = std::unordered_map<std::uint64_t, Glyph>; //!< Table mapping a codepoint to its glyph
+    struct FontHandles;
+    using GlyphTable = std::unordered_map<std::uint64_t, CachedGlyph>; //!< Table mapping a codepoint to its glyph
+    using SizeTable  = std::unordered_map<unsigned int, GlyphTable>;   //!< Table mapping a character size to its glyphs
 
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a page of glyphs
@@ -390,10 +637,56 @@ private:
     {
         explicit Page(bool smooth);
 
-        GlyphTable       glyphs;     //!< Table mapping code points to their corresponding glyph
-        Texture          texture;    //!< Texture containing the pixels of the glyphs
-        unsigned int     nextRow{3}; //!< Y position of the next new row in the texture
-        std::vector<Row> rows;       //!< List containing the position of all the existing rows
+        ////////////////////////////////////////////////////////////
+        /// \brief Forget all the packed glyphs, keeping only the reserved white square
+        ///
+        ////////////////////////////////////////////////////////////
+        void resetPacking();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Find room for a rectangle in the texture
+        ///
+        /// The rectangle is placed where its bottom edge is the
+        /// lowest (bottom-left skyline heuristic).
+        ///
+        /// \param size Width and height of the rectangle
+        ///
+        /// \return Position of the rectangle, or `std::nullopt` if it doesn't fit
+        ///
+        ////////////////////////////////////////////////////////////
+        std::optional<Vector2u> pack(Vector2u size);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Extend the area of the pixels that must be uploaded to the texture
+        ///
+        /// \param rect Rectangle of pixels that were modified
+        ///
+        ////////////////////////////////////////////////////////////
+        void markDirty(const Rect<unsigned int>& rect);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Upload the modified area of the pixels to the texture with a single update
+        ///
+        ////////////////////////////////////////////////////////////
+        void uploadPixels();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Make sure that the copy of the pixels exists, reading the texture back if needed
+        ///
+        ////////////////////////////////////////////////////////////
+        void loadPixels();
+
+        SizeTable                 glyphs;       //!< Tables mapping code points to their glyph, by character size
+        Texture                   texture;      //!< Texture containing the pixels of the glyphs
+        std::vector<std::uint8_t> pixels;       //!< Copy of the RGBA pixels of the texture (empty while not needed)
+        bool                      keepPixels{}; //!< Keep the copy of the pixels between calls (once glyphs were evicted)
+        Rect<unsigned int>        dirtyRect;    //!< Area of the pixels that isn't uploaded to the texture yet
+        std::vector<SkylineNode>  skyline;      //!< Top edge of the packed glyphs, sorted from left to right
+        std::uint64_t             packedArea{}; //!< Area of the texture covered by packed glyphs, in pixels
+        std::uint64_t             useCounter{}; //!< Counter incremented on each glyph request, for LRU eviction
+        std::uint64_t             pinnedUse{};  //!< Glyphs used since this value of the use counter are never evicted (0 if none)
+        std::size_t               evictions{};  //!< Number of glyphs evicted so far
+        std::size_t               regrowths{};  //!< Number of times the texture was enlarged so far
     };
 
     ////////////////////////////////////////////////////////////
@@ -405,6 +698,9 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief Find or create the glyphs page corresponding to the given character size
     ///
+    /// When the texture is shared or the glyphs are distance fields,
+    /// all character sizes use the same page.
+    ///
     /// \param characterSize Reference character size
     ///
     /// \return The glyphs page corresponding to \a characterSize
@@ -412,6 +708,16 @@ private:
     ////////////////////////////////////////////////////////////
     Page& loadPage(unsigned int characterSize) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the key of the glyphs page corresponding to the given character size
+    ///
+    /// \param characterSize Reference character size
+    ///
+    /// \return Key of the page in the page table
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getPageKey(unsigned int characterSize) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Load a new glyph and store it in the cache
     ///
@@ -425,6 +731,44 @@ private:
     ////////////////////////////////////////////////////////////
     Glyph loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Rasterize a glyph into a pixel buffer
+    ///
+    /// This function doesn't access the textures, nor any font
+    /// instance other than \a handles: it can be called from
+    /// any thread with its own instance of the font.
+    ///
+    /// \param handles          Font instance to use for rasterizing
+    /// \param codePoint        Unicode code point of the character to load
+    /// \param characterSize    Reference character size
+    /// \param bold             Retrieve the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+    /// \param output           Rasterized glyph to fill (its pixel buffer is reused)
+    ///
+    ////////////////////////////////////////////////////////////
+    void rasterizeGlyph(FontHandles&     handles,
+                        std::uint32_t    codePoint,
+                        unsigned int     characterSize,
+                        bool             bold,
+                        float            outlineThickness,
+                        RasterizedGlyph& output) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy the pixels of a rasterized glyph to its page
+    ///
+    /// When the page has a copy of its pixels, the texture is not
+    /// updated: the glyph is only part of the modified area of the
+    /// copy, which the caller must upload. Otherwise the glyph is
+    /// uploaded to the texture right away.
+    ///
+    /// \param rasterizedGlyph Rasterized glyph to store
+    /// \param characterSize   Reference character size
+    ///
+    /// \return The glyph, with its texture rectangle set
+    ///
+    ////////////////////////////////////////////////////////////
+    Glyph storeGlyph(const RasterizedGlyph& rasterizedGlyph, unsigned int characterSize) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Find a suitable rectangle within the texture for a glyph
     ///
@@ -436,6 +780,50 @@ private:
     ////////////////////////////////////////////////////////////
     IntRect findGlyphRect(Page& page, Vector2u size) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Evict the least recently used glyphs of a page and repack the others
+    ///
+    /// The layout of the page texture must have been invalidated
+    /// successfully before calling this function.
+    ///
+    /// \param page Page of glyphs to make room in
+    ///
+    ////////////////////////////////////////////////////////////
+    void evictGlyphs(Page& page) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of pixels kept around the glyphs in the texture
+    ///
+    /// \return Padding around the texture rectangle of the glyphs, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getGlyphPadding() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Prevent the glyphs requested from now on from being evicted
+    ///
+    /// `sf::Text` pins the glyphs of its string while laying it
+    /// out: if loading one of them evicts glyphs, the others are
+    /// moved but stay in the texture, so that laying the string
+    /// out again finds them all in place.
+    ///
+    /// \param characterSize Reference character size
+    ///
+    /// \see `unpinGlyphs`
+    ///
+    ////////////////////////////////////////////////////////////
+    void pinGlyphs(unsigned int characterSize) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Let the pinned glyphs be evicted again
+    ///
+    /// \param characterSize Reference character size
+    ///
+    /// \see `pinGlyphs`
+    ///
+    ////////////////////////////////////////////////////////////
+    void unpinGlyphs(unsigned int characterSize) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Make sure that the given size is the current one
     ///
@@ -449,16 +837,18 @@ private:
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
-    struct FontHandles;
     using PageTable = std::unordered_map<unsigned int, Page>; //!< Table mapping a character size to its page (texture)
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::shared_ptr<FontHandles> m_fontHandles;    //!< Shared information about the internal font instance
-    bool                         m_isSmooth{true}; //!< Status of the smooth filter
-    Info                         m_info;           //!< Information about the font
-    mutable PageTable            m_pages;          //!< Table containing the glyphs pages by character size
+    std::shared_ptr<FontHandles> m_fontHandles;          //!< Shared information about the internal font instance
+    bool                         m_isSmooth{true};       //!< Status of the smooth filter
+    unsigned int                 m_maximumTextureSize{}; //!< Maximum size of the page textures (0 for no limit)
+    bool                         m_isAtlasShared{};      //!< Do all character sizes share a single page?
+    bool                         m_isDistanceField{};    //!< Are the glyphs stored as signed distance fields?
+    Info                         m_info;                 //!< Information about the font
+    mutable PageTable            m_pages;                //!< Table containing the glyphs pages by character size
     mutable std::vector<std::uint8_t> m_pixelBuffer; //!< Pixel buffer holding a glyph's pixels before being written to the texture
 #ifdef SFML_SYSTEM_ANDROID
     std::shared_ptr<priv::ResourceStream> m_stream; //!< Asset file streamer (if loaded from file)
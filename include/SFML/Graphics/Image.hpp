@@ -35,8 +35,12 @@
 #include <SFML/System/Vector2.hpp>
 
 #include <filesystem>
+#include <functional>
+#include <memory>
 #include <optional>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <cstddef>
@@ -54,6 +58,74 @@ class InputStream;
 class SFML_GRAPHICS_API Image
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Function object releasing the storage of a pixel buffer
+    ///
+    /// It can be constructed from any function that accepts the
+    /// pointer to release. When it holds no function (default
+    /// constructed, or constructed from an empty function), the
+    /// pixels are released with `delete[]`.
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_GRAPHICS_API PixelDeleter
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// The pixels will be released with `delete[]`.
+        ///
+        ////////////////////////////////////////////////////////////
+        PixelDeleter() = default;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Construct the deleter from a release function
+        ///
+        /// \param function Function to call with the pointer to release
+        ///
+        ////////////////////////////////////////////////////////////
+        template <typename Function,
+                  typename = std::enable_if_t<!std::is_same_v<std::decay_t<Function>, PixelDeleter> &&
+                                              std::is_invocable_v<Function&, std::uint8_t*>>>
+        PixelDeleter(Function function) : m_function(std::move(function))
+        {
+        }
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Release a pixel buffer
+        ///
+        /// \param pixels Pointer to the pixels to release
+        ///
+        ////////////////////////////////////////////////////////////
+        void operator()(std::uint8_t* pixels) const;
+
+    private:
+        std::function<void(std::uint8_t*)> m_function; //!< Release function, `delete[]` is used if empty
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Owning pointer to an array of RGBA pixels
+    ///
+    /// The deleter is called when the image no longer
+    /// needs the pixels, which allows images to use storage
+    /// allocated by the caller (e.g. from a pool).
+    ///
+    ////////////////////////////////////////////////////////////
+    using PixelBuffer = std::unique_ptr<std::uint8_t[], PixelDeleter>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Filters available to resample an image
+    ///
+    /// \see `resample`, `createMipmap`
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class ResampleFilter
+    {
+        Box,      //!< Average of the covered pixels, nearest pixel when enlarging
+        Bilinear, //!< Linear interpolation between neighboring pixels
+        Lanczos   //!< Windowed sinc over 3 lobes, sharpest but may cause slight ringing
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -64,6 +136,32 @@ public:
     ////////////////////////////////////////////////////////////
     Image() = default;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param copy instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    Image(const Image& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy assignment operator
+    ///
+    ////////////////////////////////////////////////////////////
+    Image& operator=(const Image&);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    Image(Image&&) noexcept = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment operator
+    ///
+    ////////////////////////////////////////////////////////////
+    Image& operator=(Image&&) noexcept = default;
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct the image and fill it with a unique color
     ///
@@ -86,6 +184,23 @@ public:
     ////////////////////////////////////////////////////////////
     Image(Vector2u size, const std::uint8_t* pixels);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the image by taking ownership of an array of pixels
+    ///
+    /// The pixels are not copied, the image uses `pixels` as its
+    /// storage and releases it through its deleter.
+    /// The pixel array is assumed to contain 32-bits RGBA pixels,
+    /// and have the given `size`. If not, this is an undefined behavior.
+    /// If `pixels` is empty, an empty image is created.
+    ///
+    /// \param size   Width and height of the image
+    /// \param pixels Array of pixels to adopt
+    ///
+    /// \see `releasePixels`
+    ///
+    ////////////////////////////////////////////////////////////
+    Image(Vector2u size, PixelBuffer pixels);
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct the image from a file on disk
     ///
@@ -157,6 +272,37 @@ public:
     ////////////////////////////////////////////////////////////
     void resize(Vector2u size, const std::uint8_t* pixels);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Resize the image by taking ownership of an array of pixels
+    ///
+    /// The pixels are not copied, the image uses `pixels` as its
+    /// storage and releases it through its deleter.
+    /// The pixel array is assumed to contain 32-bits RGBA pixels,
+    /// and have the given `size`. If not, this is an undefined behavior.
+    /// If `pixels` is empty, an empty image is created.
+    ///
+    /// \param size   Width and height of the image
+    /// \param pixels Array of pixels to adopt
+    ///
+    /// \see `releasePixels`
+    ///
+    ////////////////////////////////////////////////////////////
+    void resize(Vector2u size, PixelBuffer pixels);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give up the ownership of the array of pixels
+    ///
+    /// The image becomes empty and the caller becomes responsible
+    /// for the pixels, which can then be reused (e.g. adopted by
+    /// another image of the same size) instead of being freed.
+    /// The size of the array is `width * height * 4` of the
+    /// image before the call.
+    ///
+    /// \return Array of pixels, empty if the image was empty
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] PixelBuffer releasePixels();
+
     ////////////////////////////////////////////////////////////
     /// \brief Load the image from a file on disk
     ///
@@ -357,12 +503,69 @@ public:
     ////////////////////////////////////////////////////////////
     void flipVertically();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a resized copy of the image
+    ///
+    /// The image is resampled with a separable filter: colors
+    /// are weighted by their alpha while they are filtered, so
+    /// that transparent pixels don't bleed into their opaque
+    /// neighbors.
+    ///
+    /// When \p sRgb is `true`, the colors are considered to be
+    /// encoded in sRGB: they are converted to linear light before
+    /// being filtered and converted back afterwards, which avoids
+    /// darkening the result. This should be used for color images
+    /// meant to be displayed, but not for data such as normal maps.
+    ///
+    /// The rows of the result can be computed by several threads,
+    /// which pays off for large images.
+    ///
+    /// \param size        Size of the resampled image
+    /// \param filter      Filter used to compute the pixels
+    /// \param sRgb        `true` if the pixel colors are sRGB encoded
+    /// \param threadCount Number of threads to use, 0 to use one per hardware thread
+    ///
+    /// \return Resampled image, empty if \p size or the image is empty
+    ///
+    /// \see `createMipmap`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Image resample(Vector2u       size,
+                                 ResampleFilter filter      = ResampleFilter::Bilinear,
+                                 bool           sRgb        = false,
+                                 unsigned int   threadCount = 1) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the mipmap levels of the image
+    ///
+    /// Each level is half the size of the previous one (rounded
+    /// down, but never smaller than 1), until a level of size 1x1
+    /// is reached. The image itself is the base level and is not
+    /// part of the result, which can be passed as-is to
+    /// `sf::Texture::updateMipmap`.
+    ///
+    /// Each level is filtered from the previous one at full
+    /// precision, with the same options as `resample`.
+    ///
+    /// \param filter      Filter used to compute the pixels
+    /// \param sRgb        `true` if the pixel colors are sRGB encoded
+    /// \param threadCount Number of threads to use, 0 to use one per hardware thread
+    ///
+    /// \return Mipmap levels, from the largest to the smallest
+    ///
+    /// \see `resample`, `sf::Texture::updateMipmap`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<Image> createMipmap(ResampleFilter filter      = ResampleFilter::Box,
+                                                  bool           sRgb        = false,
+                                                  unsigned int   threadCount = 1) const;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Vector2u                  m_size;   //!< Image size
-    std::vector<std::uint8_t> m_pixels; //!< Pixels of the image
+    Vector2u    m_size;   //!< Image size
+    PixelBuffer m_pixels; //!< Pixels of the image
 };
 
 } // namespace sf
@@ -390,6 +593,18 @@ private:
 /// if possible you should always use [const] references to
 /// pass or return them to avoid useless copies.
 ///
+/// Decoded images keep the buffer allocated by the decoder
+/// instead of copying it. Pixels allocated elsewhere can be
+/// adopted without a copy as a `sf::Image::PixelBuffer`, whose
+/// deleter decides what happens to the storage when the image
+/// releases it, and `releasePixels` hands the storage back to
+/// the caller, so that buffers can be pooled and reused.
+///
+/// Images can be resampled to any size with `resample`, and
+/// `createMipmap` computes a complete mipmap chain on the CPU,
+/// for example to prepare textures offline or to avoid relying
+/// on the GPU to generate mipmaps.
+///
 /// Usage example:
 /// \code
 /// // Load an image file from a file
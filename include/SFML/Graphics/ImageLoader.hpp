@@ -0,0 +1,250 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Loads a batch of images in parallel, on worker threads
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ImageLoader
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Outcome of the loading of one file of the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Result
+    {
+        std::size_t          index; //!< Index of the file in the list given to the loader
+        std::optional<Image> image; //!< Decoded image, or `std::nullopt` if loading failed
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start loading a list of image files
+    ///
+    /// Decoding starts right away on `threadCount` worker
+    /// threads, the files are picked in the order of the list.
+    /// The supported image formats are the ones of
+    /// `sf::Image::loadFromFile`.
+    ///
+    /// \param filenames   Paths of the image files to load
+    /// \param threadCount Number of worker threads, 0 to use one per hardware thread
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ImageLoader(std::vector<std::filesystem::path> filenames, unsigned int threadCount = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Cancels the loading and waits for the worker threads
+    /// to finish decoding their current image.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ImageLoader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageLoader(const ImageLoader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageLoader& operator=(const ImageLoader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageLoader(ImageLoader&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageLoader& operator=(ImageLoader&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of files of the batch
+    ///
+    /// \return Number of files given to the loader
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of files that have been processed
+    ///
+    /// This counts the files whose loading is over, successful
+    /// or not, and can be called from any thread to report the
+    /// progress of the loading.
+    ///
+    /// \return Number of files processed by the worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getProcessedCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cancel the loading
+    ///
+    /// The worker threads don't start decoding new files, and
+    /// the results that have not been retrieved yet are dropped.
+    /// This function can be called from any thread.
+    ///
+    ////////////////////////////////////////////////////////////
+    void cancel();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the loading was cancelled
+    ///
+    /// \return `true` if `cancel` was called
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isCancelled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for the next processed file
+    ///
+    /// Results are returned in the order in which the worker
+    /// threads finish them, which may differ from the order of
+    /// the list; use `Result::index` to match them with the files.
+    ///
+    /// \return Next result, or `std::nullopt` if all the results
+    ///         have been returned or the loading was cancelled
+    ///
+    /// \see `pollNext`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Result> waitNext();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the next processed file, if any, without waiting
+    ///
+    /// \return Next result, or `std::nullopt` if no file has been
+    ///         processed since the last call, all the results have
+    ///         been returned or the loading was cancelled
+    ///
+    /// \see `waitNext`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Result> pollNext();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for all the remaining images
+    ///
+    /// \return Images in the order of the list of files, `std::nullopt`
+    ///         for files that failed to load, were cancelled or
+    ///         had already been returned by `waitNext` or `pollNext`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<std::optional<Image>> waitForImages();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create textures from all the remaining images
+    ///
+    /// The textures are created on the calling thread, which
+    /// should be the thread using them, as soon as each image is
+    /// decoded: uploads overlap with the decoding of the next
+    /// images. `onProgress` is called after each texture with the
+    /// number of files handled so far and the total number of
+    /// files, it may call `cancel` to stop the loading.
+    ///
+    /// \param sRgb       `true` to enable sRGB conversion, `false` to disable it
+    /// \param onProgress Function called after each file, may be empty
+    ///
+    /// \return Textures in the order of the list of files, `std::nullopt`
+    ///         for files that failed to load, were cancelled or
+    ///         had already been returned by `waitNext` or `pollNext`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<std::optional<Texture>> uploadTextures(
+        bool                                                 sRgb       = false,
+        const std::function<void(std::size_t, std::size_t)>& onProgress = {});
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ImageLoader
+/// \ingroup graphics
+///
+/// `sf::ImageLoader` decodes a list of image files on a pool
+/// of worker threads, so that the loading time of large sets of
+/// images scales with the number of cores. Decoded images are
+/// streamed to the thread that owns the loader, which can turn
+/// them into textures while the next ones are being decoded.
+///
+/// The progress can be monitored with `getProcessedCount`, and
+/// the loading can be stopped at any time with `cancel`.
+/// Files that fail to load are reported to `sf::err()` as with
+/// `sf::Image::loadFromFile`.
+///
+/// Usage example:
+/// \code
+/// sf::ImageLoader loader(filenames);
+///
+/// // Create the textures as images are decoded, in the order of the list
+/// std::vector<std::optional<sf::Texture>> textures = loader.uploadTextures(
+///     false,
+///     [&](std::size_t done, std::size_t count)
+///     {
+///         drawLoadingScreen(static_cast<float>(done) / static_cast<float>(count));
+///         if (userQuit())
+///             loader.cancel();
+///     });
+/// \endcode
+///
+/// \see `sf::Image`, `sf::Texture`
+///
+////////////////////////////////////////////////////////////
@@ -42,6 +42,8 @@
 #include <SFML/System/Vector2.hpp>
 
 #include <array>
+#include <memory>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
@@ -50,6 +52,7 @@
 namespace sf
 {
 class Drawable;
+class IndexBuffer;
 class Shader;
 class Texture;
 class Transform;
@@ -84,13 +87,13 @@ public:
     /// \brief Move constructor
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget(RenderTarget&&) noexcept = default;
+    RenderTarget(RenderTarget&& source) noexcept;
 
     ////////////////////////////////////////////////////////////
     /// \brief Move assignment
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget& operator=(RenderTarget&&) noexcept = default;
+    RenderTarget& operator=(RenderTarget&& right) noexcept;
 
     ////////////////////////////////////////////////////////////
     /// \brief Clear the entire target with a single color
@@ -344,6 +347,168 @@ public:
               std::size_t         vertexCount,
               const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices and an array of 16-bit indices
+    ///
+    /// The primitives are assembled from the vertices referenced
+    /// by \p indices, in order. This makes it possible to share
+    /// vertices between primitives, like the corners of the two
+    /// triangles that make up a quad.
+    ///
+    /// Every index must be lower than \p vertexCount.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*        vertices,
+              std::size_t          vertexCount,
+              const std::uint16_t* indices,
+              std::size_t          indexCount,
+              PrimitiveType        type,
+              const RenderStates&  states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices and an array of 32-bit indices
+    ///
+    /// The primitives are assembled from the vertices referenced
+    /// by \p indices, in order. This makes it possible to share
+    /// vertices between primitives, like the corners of the two
+    /// triangles that make up a quad.
+    ///
+    /// Every index must be lower than \p vertexCount.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*        vertices,
+              std::size_t          vertexCount,
+              const std::uint32_t* indices,
+              std::size_t          indexCount,
+              PrimitiveType        type,
+              const RenderStates&  states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer and an index buffer
+    ///
+    /// The primitive type of the vertex buffer is used to
+    /// assemble the vertices referenced by the index buffer.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer and a range of an index buffer
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer
+    /// \param firstIndex   Index of the first index to render
+    /// \param indexCount   Number of indices to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              std::size_t         firstIndex,
+              std::size_t         indexCount,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics about the draw-call batching of a frame
+    ///
+    /// \see `getBatchStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct BatchStatistics
+    {
+        std::size_t drawCalls{};   //!< Number of vertex array draws submitted to the target
+        std::size_t mergedDraws{}; //!< Number of draws that were appended to a pending batch
+        std::size_t batches{};     //!< Number of OpenGL draw calls issued to render the batches
+        std::size_t vertices{};    //!< Number of vertices rendered through the batches
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable automatic draw-call batching
+    ///
+    /// When batching is enabled, consecutive draws of vertex
+    /// arrays (sprites, shapes, texts, ...) that share the same
+    /// blend mode, stencil mode, texture, coordinate type and
+    /// shader are not rendered immediately. Their vertices are
+    /// pre-transformed on the CPU and appended to a single
+    /// vertex stream, which is rendered with one draw call
+    /// when the render states change, when `flush()` is
+    /// called or when the target is displayed.
+    ///
+    /// Because rendering is deferred, the textures and shaders
+    /// used by the pending draws must neither be destroyed nor
+    /// modified before the batch is flushed. Shader uniforms
+    /// changed between two batched draws apply to the whole batch.
+    /// Font textures are the exception: the pending batches of
+    /// the thread that loads new glyphs are flushed before the
+    /// glyphs are moved, and the glyphs are left in place while
+    /// other threads have batches pending with the texture.
+    ///
+    /// Batching is disabled by default. Disabling it flushes
+    /// the pending batch.
+    ///
+    /// \param enabled `true` to enable batching, `false` to disable it
+    ///
+    /// \see `isBatchingEnabled`, `flush`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBatchingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether automatic draw-call batching is enabled
+    ///
+    /// \return `true` if batching is enabled, `false` otherwise
+    ///
+    /// \see `setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isBatchingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Render the draws that are pending in the current batch
+    ///
+    /// This function is called automatically whenever it is
+    /// needed, you only need to call it yourself before issuing
+    /// OpenGL commands directly or before modifying a resource
+    /// that is used by a pending draw.
+    ///
+    /// \see `setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the batching statistics of the last displayed frame
+    ///
+    /// The statistics are only collected while batching is
+    /// enabled, and are reset every time the target is displayed.
+    ///
+    /// \return Batching statistics of the last frame
+    ///
+    /// \see `setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const BatchStatistics& getBatchStatistics() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
     ///
@@ -466,7 +631,18 @@ protected:
     ////////////////////////////////////////////////////////////
     void initialize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Flush the pending batch and close the statistics of the frame
+    ///
+    /// The derived classes must call this function when the
+    /// current frame is displayed.
+    ///
+    ////////////////////////////////////////////////////////////
+    void finishFrame();
+
 private:
+    friend class Texture;
+
     ////////////////////////////////////////////////////////////
     /// \brief Apply the current view
     ///
@@ -514,6 +690,76 @@ private:
     ////////////////////////////////////////////////////////////
     void applyShader(const Shader* shader);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw indexed primitives defined by arrays of vertices and indices
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename Index>
+    void drawIndexed(const Vertex*       vertices,
+                     std::size_t         vertexCount,
+                     const Index*        indices,
+                     std::size_t         indexCount,
+                     PrimitiveType       type,
+                     const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices, bypassing the batch
+    ///
+    /// If \p indices is not null, the primitives are assembled
+    /// from the vertices that it references.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    /// \param indices     Pointer to the indices, or null to draw the vertices in order
+    /// \param indexSize   Size of an index in bytes (2 or 4)
+    /// \param indexCount  Number of indices in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawVertices(const Vertex*       vertices,
+                      std::size_t         vertexCount,
+                      PrimitiveType       type,
+                      const RenderStates& states,
+                      const void*         indices    = nullptr,
+                      std::size_t         indexSize  = 0,
+                      std::size_t         indexCount = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Prepare the pending batch to receive new primitives
+    ///
+    /// The pending batch is flushed first if its render
+    /// states are not compatible with the new ones.
+    ///
+    /// \param type   Type of primitives to draw
+    /// \param states Render states to use for drawing
+    ///
+    /// \return `true` if the primitives can be batched, `false` if they must be drawn immediately
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool prepareBatch(PrimitiveType type, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Render the pending batches of the calling thread that use a texture
+    ///
+    /// This function is called by `sf::Texture` before its pixels
+    /// are moved, so that the pending vertices are rendered with
+    /// the texture rectangles they were built for. The batches of
+    /// other threads keep holding the texture, which then leaves
+    /// its pixels in place.
+    ///
+    /// \param texture Texture about to be modified
+    ///
+    ////////////////////////////////////////////////////////////
+    static void flushBatches(const Texture& texture);
+
     ////////////////////////////////////////////////////////////
     /// \brief Setup environment for drawing
     ///
@@ -533,6 +779,17 @@ private:
     ////////////////////////////////////////////////////////////
     void drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the primitives referenced by an array of indices
+    ///
+    /// \param type       Type of primitives to draw
+    /// \param indices    Pointer to the indices, or offset in the bound index buffer
+    /// \param indexSize  Size of an index in bytes (2 or 4)
+    /// \param indexCount Number of indices to use when drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexedPrimitives(PrimitiveType type, const void* indices, std::size_t indexSize, std::size_t indexCount);
+
     ////////////////////////////////////////////////////////////
     /// \brief Clean up environment after drawing
     ///
@@ -561,12 +818,29 @@ private:
         std::array<Vertex, 4> vertexCache{};           //!< Pre-transformed vertices cache
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Pending draw-call batch
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Batch
+    {
+        bool                           enabled{};       //!< Is batching enabled?
+        RenderStates                   states;          //!< Render states shared by the pending vertices (identity transform)
+        PrimitiveType                  type{};          //!< Primitive type of the pending vertices
+        std::vector<Vertex>            vertices;        //!< Pending pre-transformed vertices
+        std::shared_ptr<const bool>    textureGuard;    //!< Keeps the texture pixels in place while the vertices are pending
+        std::shared_ptr<RenderTarget*> registration;    //!< Entry of the target in the batching targets of its thread
+        BatchStatistics                frameStatistics; //!< Statistics of the frame in progress
+        BatchStatistics                lastStatistics;  //!< Statistics of the last displayed frame
+    };
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     View          m_defaultView; //!< Default view
     View          m_view;        //!< Current view
     StatesCache   m_cache{};     //!< Render states cache
+    Batch         m_batch;       //!< Pending draw-call batch
     std::uint64_t m_id{};        //!< Unique number that identifies the RenderTarget
 };
 
@@ -0,0 +1,331 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Window/ContextSettings.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class RenderTexture;
+
+////////////////////////////////////////////////////////////
+/// \brief Recycles render textures between uses, so that
+///        transient render targets are not recreated every frame
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API RenderTexturePool
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Exclusive use of a render texture of the pool
+    ///
+    /// The render texture goes back to the pool when the lease
+    /// is destroyed.
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_GRAPHICS_API Lease
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        /// Gives the render texture back to the pool.
+        ///
+        ////////////////////////////////////////////////////////////
+        ~Lease();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        Lease(const Lease&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        Lease& operator=(const Lease&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        Lease(Lease&& source) noexcept;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move assignment
+        ///
+        /// Gives the currently leased render texture back to the
+        /// pool before taking over the one of \p right.
+        ///
+        ////////////////////////////////////////////////////////////
+        Lease& operator=(Lease&& right) noexcept;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Access the leased render texture
+        ///
+        /// \return Reference to the render texture
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] RenderTexture& operator*() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Access the members of the leased render texture
+        ///
+        /// \return Pointer to the render texture
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] RenderTexture* operator->() const;
+
+    private:
+        friend class RenderTexturePool;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Construct a lease of a render texture of the pool
+        ///
+        /// \param pool          Pool owning the render texture
+        /// \param renderTexture Leased render texture
+        ///
+        ////////////////////////////////////////////////////////////
+        Lease(RenderTexturePool& pool, RenderTexture& renderTexture);
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        RenderTexturePool* m_pool{};          //!< Pool owning the render texture, null once moved from
+        RenderTexture*     m_renderTexture{}; //!< Leased render texture
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty pool.
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Destroys all the render textures of the pool. All the
+    /// leases must have been destroyed before the pool.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~RenderTexturePool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool(const RenderTexturePool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool& operator=(const RenderTexturePool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Lease a render texture
+    ///
+    /// An idle render texture created with the same size and
+    /// the same depth, stencil, anti-aliasing and sRGB settings
+    /// is reused if there is one, otherwise a new one is created.
+    ///
+    /// A reused render texture is in the state of a new one
+    /// (not smooth, not repeated, no mipmap, batching disabled,
+    /// default view), but the contents left by its previous
+    /// user are kept: clear it before drawing if needed.
+    ///
+    /// \param size     Width and height of the render texture
+    /// \param settings Additional settings for the underlying OpenGL texture and context
+    ///
+    /// \return Lease of the render texture
+    ///
+    /// \throws sf::Exception if a new render texture can't be created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Lease acquire(Vector2u size, const ContextSettings& settings = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start a new generation
+    ///
+    /// Call this function once per frame. Render textures that
+    /// have not been leased during the last `getMaxIdleGenerations()`
+    /// generations are destroyed, so that targets which are not
+    /// needed anymore (e.g. after a resize) don't keep graphics
+    /// memory allocated.
+    ///
+    ////////////////////////////////////////////////////////////
+    void nextGeneration();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current generation
+    ///
+    /// \return Number of calls to `nextGeneration()` so far
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getGeneration() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set how many generations an idle render texture is kept
+    ///
+    /// The default value is 2.
+    ///
+    /// \param generations Number of generations
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaxIdleGenerations(unsigned int generations);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get how many generations an idle render texture is kept
+    ///
+    /// \return Number of generations
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getMaxIdleGenerations() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of render textures owned by the pool
+    ///
+    /// \return Number of leased and idle render textures
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of render textures ready to be reused
+    ///
+    /// \return Number of idle render textures
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getIdleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy all the idle render textures
+    ///
+    /// Leased render textures are not affected.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Give a leased render texture back to the pool
+    ///
+    /// The pending batched draws are rendered, the texture is
+    /// updated and the state of the render texture is reset
+    /// so that it can be handed out to another user.
+    ///
+    /// \param renderTexture Render texture to give back
+    ///
+    ////////////////////////////////////////////////////////////
+    void release(RenderTexture& renderTexture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Render texture owned by the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        std::unique_ptr<RenderTexture> renderTexture; //!< Pooled render texture
+        ContextSettings                settings;      //!< Settings the render texture was created with
+        std::uint64_t                  lastUsed{};    //!< Last generation in which the render texture was leased
+        bool                           leased{};      //!< Is the render texture currently leased?
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Entry> m_entries;               //!< Render textures owned by the pool
+    std::uint64_t      m_generation{};          //!< Current generation
+    unsigned int       m_maxIdleGenerations{2}; //!< Number of generations an idle render texture is kept
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RenderTexturePool
+/// \ingroup graphics
+///
+/// Post-processing effects typically render into a chain of
+/// intermediate targets that are only needed for the duration
+/// of a frame. Creating an `sf::RenderTexture` for each of them
+/// every frame means allocating a texture, a frame buffer and
+/// its attachments over and over again.
+///
+/// `sf::RenderTexturePool` keeps the render textures once they
+/// are not needed anymore, and hands them out again when a
+/// render texture with the same size and settings is requested.
+/// Once the pool has warmed up, leasing a render texture costs
+/// no allocation at all.
+///
+/// The pool counts generations, usually frames: render textures
+/// left idle for a few generations are destroyed, so that the
+/// pool only keeps what the application still uses.
+///
+/// Usage example:
+/// \code
+/// sf::RenderTexturePool pool;
+///
+/// while (window.isOpen())
+/// {
+///     {
+///         const auto scene = pool.acquire(window.getSize());
+///         scene->clear();
+///         scene->draw(...);
+///         scene->display();
+///
+///         const auto blurred = pool.acquire(window.getSize() / 2u);
+///         blurred->clear();
+///         blurred->draw(sf::Sprite(scene->getTexture()), &blurShader);
+///         blurred->display();
+///
+///         window.draw(sf::Sprite(blurred->getTexture()), &compositeShader);
+///     } // the render textures go back to the pool here
+///
+///     window.display();
+///     pool.nextGeneration();
+/// }
+/// \endcode
+///
+/// \see `sf::RenderTexture`
+///
+////////////////////////////////////////////////////////////
@@ -198,6 +198,16 @@ protected:
     ////////////////////////////////////////////////////////////
     void onResize() override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called before the window is displayed
+    ///
+    /// This function renders the pending batched draws, if any.
+    ///
+    /// \see `RenderTarget::setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void onDisplay() override;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -37,14 +37,18 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <variant>
+#include <vector>
 
 #include <cstddef>
+#include <cstdint>
 
 
 namespace sf
 {
 class InputStream;
 class Texture;
+class UniformBuffer;
 
 ////////////////////////////////////////////////////////////
 /// \brief Shader class (vertex, geometry and fragment)
@@ -84,6 +88,55 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static inline CurrentTextureType CurrentTexture;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Pre-resolved reference to a uniform variable
+    ///
+    /// A handle is obtained once with getUniformHandle() and can
+    /// then be passed to the `setUniform(UniformHandle, ...)`
+    /// overloads, which neither look the name up nor touch
+    /// the OpenGL state.
+    ///
+    /// A handle is only valid for the shader that created it,
+    /// and until that shader is loaded again. Values assigned
+    /// through a handle that is no longer valid are ignored.
+    ///
+    /// \see `getUniformHandle`
+    ///
+    ////////////////////////////////////////////////////////////
+    class UniformHandle
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Default constructor
+        ///
+        /// Creates an invalid handle, values assigned through it
+        /// are ignored.
+        ///
+        ////////////////////////////////////////////////////////////
+        constexpr UniformHandle() = default;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether the handle refers to an active uniform
+        ///
+        /// \return `true` if the uniform was found in the shader
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] constexpr bool isValid() const
+        {
+            return m_location != -1;
+        }
+
+    private:
+        friend class Shader;
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        int           m_location{-1}; //!< Location of the uniform in the program
+        std::size_t   m_index{};      //!< Index of the deferred value slot in the shader
+        std::uint64_t m_programId{};  //!< Identifier of the program that the handle was created for
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -718,6 +771,44 @@ public:
     ////////////////////////////////////////////////////////////
     void setUniform(const std::string& name, CurrentTextureType);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify the buffer holding the values of a uniform block
+    ///
+    /// The buffer is bound to the block every time the shader is
+    /// used, so that its current contents are visible to the
+    /// shader. The same buffer can be assigned to blocks of any
+    /// number of shaders.
+    ///
+    /// Example:
+    /// \code
+    /// layout(std140) uniform Camera // this is the block in the shader
+    /// {
+    ///     mat4 viewProjection;
+    /// };
+    /// \endcode
+    /// \code
+    /// sf::UniformBuffer camera;
+    /// ...
+    /// shader.setUniformBlock("Camera", camera);
+    /// \endcode
+    ///
+    /// It is important to note that \p buffer must remain alive as long
+    /// as the shader uses it, no copy is made internally.
+    ///
+    /// \param name   Name of the uniform block in the shader
+    /// \param buffer Buffer holding the values of the block
+    ///
+    /// \see `sf::UniformBuffer`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformBlock(const std::string& name, const UniformBuffer& buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary uniform buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformBlock(const std::string& name, const UniformBuffer&& buffer) = delete;
+
     ////////////////////////////////////////////////////////////
     /// \brief Specify values for \p float[] array uniform
     ///
@@ -778,6 +869,190 @@ public:
     ////////////////////////////////////////////////////////////
     void setUniformArray(const std::string& name, const Glsl::Mat4* matrixArray, std::size_t length);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a handle to a uniform variable
+    ///
+    /// The name is resolved only once; the returned handle can
+    /// then be used with the `setUniform(UniformHandle, ...)`
+    /// overloads to update the variable without any lookup.
+    ///
+    /// Example:
+    /// \code
+    /// const auto offset = shader.getUniformHandle("offset");
+    /// ...
+    /// shader.setUniform(offset, 2.f);
+    /// \endcode
+    ///
+    /// \param name Name of the uniform variable in GLSL
+    ///
+    /// \return Handle to the uniform, invalid if the variable doesn't exist
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] UniformHandle getUniformHandle(const std::string& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p float uniform through a handle
+    ///
+    /// Unlike the overloads taking a name, this function doesn't
+    /// access OpenGL: the value is stored and uploaded in bulk,
+    /// together with the other pending values, the next time the
+    /// shader is bound (which happens when it is used to draw).
+    /// A value set through a handle therefore takes precedence
+    /// over a value set by name for the same variable since the
+    /// last bind.
+    ///
+    /// Invalid handles are ignored.
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param x      Value of the \p float scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, float x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec2 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the \p vec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, Glsl::Vec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec3 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the \p vec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Vec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec4 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the \p vec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Vec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p int uniform through a handle
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param x      Value of the \p int scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, int x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec2 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the \p ivec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, Glsl::Ivec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec3 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the \p ivec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Ivec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec4 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the \p ivec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Ivec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bool uniform through a handle
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param x      Value of the \p bool scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, bool x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec2 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the \p bvec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, Glsl::Bvec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec3 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the \p bvec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Bvec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec4 uniform through a handle
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param vector Value of the \p bvec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Bvec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p mat3 matrix through a handle
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param matrix Value of the \p mat3 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Mat3& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p mat4 matrix through a handle
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param matrix Value of the \p mat4 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Mat4& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify a texture as \p sampler2D uniform through a handle
+    ///
+    /// \param handle  Handle to the uniform variable
+    /// \param texture Texture to assign
+    ///
+    /// \see `setUniform(const std::string&, const Texture&)`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Texture&& texture) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify current texture as \p sampler2D uniform through a handle
+    ///
+    /// \param handle Handle to the uniform variable
+    ///
+    /// \see `setUniform(const std::string&, CurrentTextureType)`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, CurrentTextureType);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the underlying OpenGL handle of the shader.
     ///
@@ -844,6 +1119,46 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static bool isGeometryAvailable();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the directory where linked programs are cached
+    ///
+    /// When a directory is set and the system supports program
+    /// binaries (see isBinaryCacheAvailable()), every program
+    /// successfully linked by the load functions is saved to
+    /// this directory. Loading the same sources again, with the
+    /// same graphics driver, restores the saved program instead
+    /// of compiling and linking the sources, which is usually
+    /// much faster.
+    ///
+    /// Cached programs are identified by a hash of their sources
+    /// and of the vendor, renderer and version strings of the
+    /// driver. An entry that can't be restored, for example
+    /// after a driver update, is deleted and the sources are
+    /// compiled as if the cache was disabled.
+    ///
+    /// The directory is created if it doesn't exist. Passing an
+    /// empty path disables the cache, which is the default.
+    ///
+    /// \param directory Path of the cache directory
+    ///
+    /// \see `isBinaryCacheAvailable`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setBinaryCacheDirectory(const std::filesystem::path& directory);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports caching linked programs
+    ///
+    /// Note: The first call to this function, whether by your
+    /// code or SFML will result in a context switch.
+    ///
+    /// \return `true` if program binaries can be retrieved and restored, `false` otherwise
+    ///
+    /// \see `setBinaryCacheDirectory`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isBinaryCacheAvailable();
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Compile the shader(s) and create the program
@@ -871,6 +1186,16 @@ private:
     ////////////////////////////////////////////////////////////
     void bindTextures() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind all the uniform buffers used by the shader
+    ///
+    /// This function binds each buffer to a different binding
+    /// point, and assigns the corresponding uniform blocks in
+    /// the shader to it.
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindUniformBlocks() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the location ID of a shader uniform
     ///
@@ -881,6 +1206,60 @@ private:
     ////////////////////////////////////////////////////////////
     int getUniformLocation(const std::string& name);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Map a texture to a \p sampler2D uniform location
+    ///
+    /// \param location Location of the uniform in the program
+    /// \param texture  Texture to assign
+    ///
+    /// \return `false` if all the texture units are already used
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setTextureUniform(int location, const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Types of the values that can be set through a handle
+    ///
+    ////////////////////////////////////////////////////////////
+    using UniformValue = std::variant<float,
+                                      Glsl::Vec2,
+                                      Glsl::Vec3,
+                                      Glsl::Vec4,
+                                      int,
+                                      Glsl::Ivec2,
+                                      Glsl::Ivec3,
+                                      Glsl::Ivec4,
+                                      Glsl::Mat3,
+                                      Glsl::Mat4>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store a value to upload at the next bind
+    ///
+    /// \param handle Handle to the uniform variable
+    /// \param value  Value to upload
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDeferredUniform(UniformHandle handle, const UniformValue& value);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the values set through handles since the last bind
+    ///
+    /// The program must be bound when this function is called.
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyDeferredUniforms() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Value set through a handle, waiting to be uploaded
+    ///
+    ////////////////////////////////////////////////////////////
+    struct DeferredUniform
+    {
+        int          location{-1}; //!< Location of the uniform in the program
+        UniformValue value;        //!< Last value assigned through the handle
+        bool         pending{};    //!< Is the value waiting to be uploaded?
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief RAII object to save and restore the program
     ///        binding while uniforms are being set
@@ -893,16 +1272,22 @@ private:
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
-    using TextureTable = std::unordered_map<int, const Texture*>;
-    using UniformTable = std::unordered_map<std::string, int>;
+    using TextureTable      = std::unordered_map<int, const Texture*>;
+    using UniformTable      = std::unordered_map<std::string, int>;
+    using UniformBlockTable = std::unordered_map<unsigned int, const UniformBuffer*>;
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int m_shaderProgram{};    //!< OpenGL identifier for the program
-    int          m_currentTexture{-1}; //!< Location of the current texture in the shader
-    TextureTable m_textures;           //!< Texture variables in the shader, mapped to their location
-    UniformTable m_uniforms;           //!< Parameters location cache
+    unsigned int      m_shaderProgram{};    //!< OpenGL identifier for the program
+    std::uint64_t     m_programId{};        //!< Unique identifier of the loaded program, checked by the uniform handles
+    int               m_currentTexture{-1}; //!< Location of the current texture in the shader
+    TextureTable      m_textures;           //!< Texture variables in the shader, mapped to their location
+    UniformTable      m_uniforms;           //!< Parameters location cache
+    UniformBlockTable m_uniformBlocks;      //!< Uniform blocks in the shader, mapped to their index
+
+    mutable std::vector<DeferredUniform> m_deferredUniforms; //!< Value slots of the uniform handles
+    mutable std::vector<std::size_t>     m_pendingUniforms;  //!< Indices of the slots to upload at the next bind
 };
 
 } // namespace sf
@@ -938,6 +1323,7 @@ private:
 /// \li vectors (2, 3 or 4 components)
 /// \li matrices (3x3 or 4x4)
 /// \li samplers (textures)
+/// \li uniform blocks (see `sf::UniformBuffer`)
 ///
 /// Some SFML-specific types can be converted:
 /// \li `sf::Color` as a 4D vector (\p vec4)
@@ -969,6 +1355,18 @@ private:
 /// given \p sampler2D uniform to the current texture of the
 /// object being drawn (which cannot be known in advance).
 ///
+/// Uniforms that are updated very often can be resolved once
+/// with `getUniformHandle()`. Setting a value through a handle
+/// skips the name lookup and defers the upload until the shader
+/// is bound for drawing, where all pending values are uploaded
+/// at once:
+/// \code
+/// const auto time = shader.getUniformHandle("time");
+/// ...
+/// shader.setUniform(time, elapsed.asSeconds());
+/// window.draw(sprite, &shader);
+/// \endcode
+///
 /// To apply a shader to a drawable, you must pass it as an
 /// additional parameter to the `RenderWindow::draw` function:
 /// \code
@@ -0,0 +1,317 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Drawable set of sprites sharing the same texture,
+///        rendered with a single draw call
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SpriteBatch : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Per-instance attributes of a sprite of the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Instance
+    {
+        Transform transform;           //!< Transform of the instance, relative to the batch
+        IntRect   textureRect;         //!< Area of the texture displayed by the instance
+        Color     color{Color::White}; //!< Global color of the instance
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty sprite batch from a source texture
+    ///
+    /// \param texture Source texture
+    ///
+    /// \see `setTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SpriteBatch(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow construction from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SpriteBatch(const Texture&& texture) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the source texture of the sprite batch
+    ///
+    /// The `texture` argument refers to a texture that must
+    /// exist as long as the sprite batch uses it. The texture
+    /// rectangles of the instances are left unchanged.
+    ///
+    /// \param texture New texture
+    ///
+    /// \see `getTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture&& texture) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the source texture of the sprite batch
+    ///
+    /// \return Reference to the sprite batch's texture
+    ///
+    /// \see `setTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an instance at the end of the batch
+    ///
+    /// \param instance Instance to add
+    ///
+    /// \return Index of the new instance
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t append(const Instance& instance);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the attributes of an instance
+    ///
+    /// Only the geometry of the modified instances is
+    /// transferred to graphics memory on the next draw.
+    ///
+    /// \param index    Index of the instance to change, must be in range [0 .. getInstanceCount() - 1]
+    /// \param instance New attributes of the instance
+    ///
+    /// \see `getInstance`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setInstance(std::size_t index, const Instance& instance);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the attributes of an instance
+    ///
+    /// \param index Index of the instance to get, must be in range [0 .. getInstanceCount() - 1]
+    ///
+    /// \return Attributes of the instance
+    ///
+    /// \see `setInstance`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Instance& getInstance(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the number of instances in the batch
+    ///
+    /// \return Number of instances
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getInstanceCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Resize the batch
+    ///
+    /// If `instanceCount` is greater than the current size, the
+    /// new instances are default-constructed (they display
+    /// nothing until their texture rectangle is set).
+    ///
+    /// \param instanceCount New number of instances
+    ///
+    ////////////////////////////////////////////////////////////
+    void resize(std::size_t instanceCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the instances of the batch
+    ///
+    /// The graphics memory that was allocated is kept, so that
+    /// the batch can be refilled without reallocating.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the storage of the geometry in graphics memory
+    ///
+    /// By default, the geometry is kept in a vertex buffer when
+    /// vertex buffers are available. Disabling it draws the
+    /// instances from system memory and releases the vertex
+    /// buffer, which suits batches that are rebuilt entirely
+    /// every frame: their geometry is then transferred only once,
+    /// and they can be merged with the neighboring draws when
+    /// the render target batches them.
+    ///
+    /// \param enabled `true` to use a vertex buffer, `false` to draw from system memory
+    ///
+    /// \see `isVertexBufferEnabled`, `RenderTarget::setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVertexBufferEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the geometry may be stored in graphics memory
+    ///
+    /// \return `true` if a vertex buffer is used when available, `false` otherwise
+    ///
+    /// \see `setVertexBufferEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isVertexBufferEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in local coordinates, which means
+    /// that it ignores the transformations (translation, rotation,
+    /// scale, ...) that are applied to the entity.
+    /// In other words, this function returns the bounds of the
+    /// entity in the entity's coordinate system.
+    ///
+    /// \return Local bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in global coordinates, which means
+    /// that it takes into account the transformations (translation,
+    /// rotation, scale, ...) that are applied to the entity.
+    /// In other words, this function returns the bounds of the
+    /// sprite batch in the global 2D world's coordinate system.
+    ///
+    /// \return Global bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getGlobalBounds() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the sprite batch to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the vertices of an instance
+    ///
+    /// \param index Index of the instance to update
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateVertices(std::size_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Transfer the modified vertices to the vertex buffer
+    ///
+    /// \return `true` if the vertex buffer is up to date, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool ensureBufferUpdate() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Instance> m_instances;                   //!< Attributes of the instances
+    std::vector<Vertex>   m_vertices;                    //!< Vertices of the instances, 6 per instance
+    const Texture*        m_texture;                     //!< Texture of the instances
+    mutable VertexBuffer  m_vertexBuffer;                //!< Vertices stored in graphics memory
+    mutable std::size_t   m_dirtyBegin{};                //!< First instance to transfer to the vertex buffer
+    mutable std::size_t   m_dirtyEnd{};                  //!< One past the last instance to transfer to the vertex buffer
+    bool                  m_isVertexBufferEnabled{true}; //!< Draw from the vertex buffer when available?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpriteBatch
+/// \ingroup graphics
+///
+/// `sf::SpriteBatch` renders many textured quads sharing the
+/// same texture with a single draw call. Each instance has its
+/// own transform, texture rectangle and color, and behaves like
+/// a `sf::Sprite` with the same attributes.
+///
+/// The geometry of the instances is kept in a `sf::VertexBuffer`,
+/// and only the instances that were modified since the last draw
+/// are transferred to graphics memory. If vertex buffers are not
+/// available or disabled with `setVertexBufferEnabled`, the
+/// instances are drawn from system memory, still with a single
+/// draw call.
+///
+/// The batch itself inherits `sf::Transformable`: its transform
+/// is combined with the transform of every instance.
+///
+/// Like `sf::Sprite`, the batch doesn't copy the texture that
+/// it uses, it only keeps a reference to it.
+///
+/// Usage example:
+/// \code
+/// const sf::Texture texture("particles.png");
+///
+/// sf::SpriteBatch batch(texture);
+/// for (const auto& particle : particles)
+/// {
+///     sf::Transform transform;
+///     transform.translate(particle.position).rotate(particle.angle);
+///     batch.append({transform, {{0, 0}, {8, 8}}, particle.color});
+/// }
+///
+/// window.draw(batch);
+/// \endcode
+///
+/// \see `sf::Sprite`, `sf::VertexBuffer`
+///
+////////////////////////////////////////////////////////////
@@ -40,6 +40,9 @@
 #include <SFML/System/String.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <memory>
+#include <vector>
+
 #include <cstddef>
 #include <cstdint>
 
@@ -106,6 +109,11 @@ public:
     /// \endcode
     /// A text's string is empty by default.
     ///
+    /// When the new string only appends characters to the
+    /// current one, the geometry of the existing characters is
+    /// kept and only the new characters are laid out, which
+    /// makes growing texts (logs, consoles, ...) cheap to update.
+    ///
     /// \param string New string
     ///
     /// \see `getString`
@@ -406,9 +414,56 @@ private:
     /// All the attributes related to rendering are cached, such
     /// that the geometry is only updated when necessary.
     ///
+    /// Loading the glyphs may evict others from the font texture
+    /// and move the remaining ones, including glyphs that were
+    /// already laid out: the text is then laid out again, until
+    /// the font texture doesn't change anymore.
+    ///
     ////////////////////////////////////////////////////////////
     void ensureGeometryUpdate() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Lay out the characters that are not laid out yet
+    ///
+    /// The whole string is laid out again if an attribute or
+    /// the font texture changed since the last layout.
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateGeometry() const;
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    struct DistanceFieldShaders;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief State of the layout after the last laid out character
+    ///
+    /// Appending characters to the string resumes the layout
+    /// from this state instead of starting over.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct LayoutState
+    {
+        std::size_t   characterCount{};     //!< Number of characters of the string laid out so far
+        Vector2f      position;             //!< Position of the next character
+        std::uint32_t previousCharacter{};  //!< Last character laid out, for kerning
+        Vector2f      minimum;              //!< Top-left corner of the bounds, without the outline
+        Vector2f      maximum;              //!< Bottom-right corner of the bounds, without the outline
+        std::size_t   vertexCount{};        //!< Number of fill vertices, without the lines of the last row
+        std::size_t   outlineVertexCount{}; //!< Number of outline vertices, without the lines of the last row
+        std::size_t   indexCount{};         //!< Number of fill indices, without the lines of the last row
+        std::size_t   outlineIndexCount{};  //!< Number of outline indices, without the lines of the last row
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shaders rendering distance field glyphs, shared by all texts
+    ///
+    /// \return The shaders, or a null pointer if they are not available
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::shared_ptr<DistanceFieldShaders> getDistanceFieldShaders();
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -425,7 +480,13 @@ private:
     mutable VertexArray   m_outlineVertices{PrimitiveType::Triangles}; //!< Vertex array containing the outline geometry
     mutable FloatRect     m_bounds;               //!< Bounding rectangle of the text (in local coordinates)
     mutable bool          m_geometryNeedUpdate{}; //!< Does the geometry need to be recomputed?
-    mutable std::uint64_t m_fontTextureId{};      //!< The font texture id
+    mutable std::uint64_t m_fontLayoutId{};       //!< Layout identifier of the font texture when the text was laid out
+
+    mutable std::vector<std::uint16_t> m_indices;        //!< Indices of the fill triangles, relative to their chunk
+    mutable std::vector<std::uint16_t> m_outlineIndices; //!< Indices of the outline triangles, relative to their chunk
+
+    mutable std::shared_ptr<DistanceFieldShaders> m_distanceFieldShaders; //!< Shaders rendering distance field glyphs
+    mutable LayoutState                           m_layout;               //!< State of the layout of the geometry
 };
 
 } // namespace sf
@@ -464,6 +525,13 @@ private:
 /// used by a `sf::Text` (i.e. never write a function that
 /// uses a local `sf::Font` instance for creating a text).
 ///
+/// When the font uses distance field glyphs (see
+/// `sf::Font::setDistanceFieldEnabled`), the text is rendered
+/// with a built-in shader that reconstructs sharp glyph edges
+/// and the outline from the field, unless a shader is already
+/// set in the render states. The glyphs then stay crisp when
+/// the text is scaled, without rasterizing the font again.
+///
 /// See also the note on coordinates and undistorted rendering in `sf::Transformable`.
 ///
 /// Usage example:
@@ -36,7 +36,10 @@
 
 #include <SFML/System/Vector2.hpp>
 
+#include <atomic>
 #include <filesystem>
+#include <memory>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
@@ -379,6 +382,77 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool loadFromImage(const Image& image, bool sRgb = false, const IntRect& area = {});
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the texture from a DDS or KTX2 file
+    ///
+    /// Unlike `loadFromFile`, the pixels are not decoded to an
+    /// image first: they are uploaded as they are stored in the
+    /// file, along with its mipmap levels if it contains all of
+    /// them (down to 1x1).
+    ///
+    /// Block compressed formats (BC1, BC2, BC3, BC7 and ETC2)
+    /// stay compressed on the graphics card when the driver
+    /// supports them, which makes them 4 to 8 times smaller
+    /// than uncompressed pixels. When it doesn't, BC1, BC2 and
+    /// BC3 are decompressed on the CPU, and the other formats
+    /// fail to load. Uncompressed RGBA and BGRA pixels are
+    /// supported too.
+    ///
+    /// Whether the colors are sRGB encoded is defined by the
+    /// format stored in the file. Cube maps, texture arrays,
+    /// volume textures and supercompressed KTX2 files are not
+    /// supported.
+    ///
+    /// A texture stored compressed on the graphics card can't
+    /// be modified with `update`.
+    ///
+    /// If this function fails, the texture is left unchanged.
+    ///
+    /// \param filename Path of the file to load
+    ///
+    /// \return `true` if loading was successful, `false` if it failed
+    ///
+    /// \see `loadFromCompressedMemory`, `loadFromCompressedStream`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromCompressedFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the texture from a DDS or KTX2 file in memory
+    ///
+    /// See `loadFromCompressedFile` for the supported formats.
+    /// When the format is supported by the driver, the pixels are
+    /// uploaded directly from \p data without being copied, so
+    /// that a memory-mapped file can be passed as is.
+    ///
+    /// If this function fails, the texture is left unchanged.
+    ///
+    /// \param data Pointer to the file data in memory
+    /// \param size Size of the data to load, in bytes
+    ///
+    /// \return `true` if loading was successful, `false` if it failed
+    ///
+    /// \see `loadFromCompressedFile`, `loadFromCompressedStream`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromCompressedMemory(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the texture from a DDS or KTX2 file in a custom stream
+    ///
+    /// See `loadFromCompressedFile` for the supported formats.
+    ///
+    /// If this function fails, the texture is left unchanged.
+    ///
+    /// \param stream Source stream to read from
+    ///
+    /// \return `true` if loading was successful, `false` if it failed
+    ///
+    /// \see `loadFromCompressedFile`, `loadFromCompressedMemory`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromCompressedStream(InputStream& stream);
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the texture
     ///
@@ -440,6 +514,32 @@ public:
     ////////////////////////////////////////////////////////////
     void update(const std::uint8_t* pixels, Vector2u size, Vector2u dest);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the texture from a region of a larger array of pixels
+    ///
+    /// The rows of the region are `stride` pixels apart in
+    /// `pixels`, which makes it possible to upload a rectangle
+    /// cropped out of a larger image without copying it first.
+    /// The region is uploaded with a single call when the driver
+    /// supports it, otherwise its rows are packed together first.
+    /// The pixel array must contain 32-bits RGBA pixels.
+    ///
+    /// No additional check is performed on the size of the pixel
+    /// array or the bounds of the area to update. Passing invalid
+    /// arguments will lead to an undefined behavior.
+    ///
+    /// This function does nothing if `pixels` is null or if the
+    /// texture was not previously created.
+    ///
+    /// \param pixels Pointer to the first pixel of the region to copy to the texture
+    /// \param size   Width and height of the region
+    /// \param dest   Coordinates of the destination position
+    /// \param stride Number of pixels between the starts of two consecutive rows
+    ///               in `pixels`, must be at least `size.x`
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const std::uint8_t* pixels, Vector2u size, Vector2u dest, unsigned int stride);
+
     ////////////////////////////////////////////////////////////
     /// \brief Update a part of this texture from another texture
     ///
@@ -646,6 +746,31 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool generateMipmap();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload a mipmap computed on the CPU
+    ///
+    /// This is an alternative to `generateMipmap` which doesn't
+    /// depend on any OpenGL extension, and gives control over the
+    /// filter used to compute the levels. \p levels must contain
+    /// every level below the base one, as returned by
+    /// `sf::Image::createMipmap`: each level is half the size of
+    /// the previous one (rounded down, but never smaller than 1),
+    /// down to a level of size 1x1.
+    ///
+    /// The texture must not be padded to a power of two, and its
+    /// pixels must not be flipped (which is the case for the
+    /// texture of a `sf::RenderTexture`). As with `generateMipmap`,
+    /// the mipmap is invalidated when the base level is modified.
+    ///
+    /// \param levels Pixels of the mipmap levels, from the largest to the smallest
+    ///
+    /// \return `true` if the mipmap was uploaded, `false` if the levels don't match the texture
+    ///
+    /// \see `generateMipmap`, `sf::Image::createMipmap`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool updateMipmap(const std::vector<Image>& levels);
+
     ////////////////////////////////////////////////////////////
     /// \brief Swap the contents of this texture with those of another
     ///
@@ -712,9 +837,11 @@ public:
     [[nodiscard]] static unsigned int getMaximumSize();
 
 private:
+    friend class Font;
     friend class Text;
     friend class RenderTexture;
     friend class RenderTarget;
+    friend class TextureReader;
 
     ////////////////////////////////////////////////////////////
     /// \brief Get a valid image size according to hardware support
@@ -740,19 +867,38 @@ private:
     ////////////////////////////////////////////////////////////
     void invalidateMipmap();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Announce that the pixels of the texture are about to be moved
+    ///
+    /// The draws batched with the texture by the calling thread
+    /// are rendered first. If no other thread has batched draws
+    /// pending with the texture, its layout identifier changes,
+    /// so that the geometries built from the old pixel positions
+    /// can tell that they are outdated. Otherwise the pixels must
+    /// stay where they are, since the batches of other threads
+    /// can only be rendered by these threads.
+    /// This function is mainly for internal use by Font.
+    ///
+    /// \return `true` if the pixels can be moved, `false` if they must stay in place
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool invalidateLayout();
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Vector2u      m_size;            //!< Public texture size
-    Vector2u      m_actualSize;      //!< Actual texture size (can be greater than public size because of padding)
-    unsigned int  m_texture{};       //!< Internal texture identifier
-    bool          m_isSmooth{};      //!< Status of the smooth filter
-    bool          m_sRgb{};          //!< Should the texture source be converted from sRGB?
-    bool          m_isRepeated{};    //!< Is the texture in repeat mode?
-    mutable bool  m_pixelsFlipped{}; //!< To work around the inconsistency in Y orientation
-    bool          m_fboAttachment{}; //!< Is this texture owned by a framebuffer object?
-    bool          m_hasMipmap{};     //!< Has the mipmap been generated?
-    std::uint64_t m_cacheId;         //!< Unique number that identifies the texture to the render target's cache
+    Vector2u                    m_size;            //!< Public texture size
+    Vector2u                    m_actualSize;      //!< Actual texture size (can be greater than public size because of padding)
+    unsigned int                m_texture{};       //!< Internal texture identifier
+    bool                        m_isSmooth{};      //!< Status of the smooth filter
+    bool                        m_sRgb{};          //!< Should the texture source be converted from sRGB?
+    bool                        m_isRepeated{};    //!< Is the texture in repeat mode?
+    mutable bool                m_pixelsFlipped{}; //!< To work around the inconsistency in Y orientation
+    bool                        m_fboAttachment{}; //!< Is this texture owned by a framebuffer object?
+    bool                        m_hasMipmap{};     //!< Has the mipmap been generated?
+    std::uint64_t               m_cacheId;         //!< Unique number that identifies the texture to the render target's cache
+    std::atomic<std::uint64_t>  m_layoutId;        //!< Unique number that changes whenever the pixels are moved (not swapped)
+    std::shared_ptr<const bool> m_batchGuard;      //!< Held by the batches that have pending draws with the texture
 };
 
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,226 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Reads the pixels of textures back from the graphics
+///        card without stalling the rendering
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureReader : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the reader
+    ///
+    /// Each buffer holds one readback in flight: with 2 or 3
+    /// buffers, the pixels of a frame can be transferred while
+    /// the next frames are being rendered.
+    ///
+    /// \param bufferCount Maximum number of readbacks in flight, at least 1
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TextureReader(std::size_t bufferCount = 3);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Readbacks that are still in flight are discarded.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureReader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReader(const TextureReader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReader& operator=(const TextureReader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReader(TextureReader&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReader& operator=(TextureReader&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start reading back the pixels of a texture
+    ///
+    /// The copy is queued on the graphics card and this function
+    /// returns immediately; the pixels are retrieved later with
+    /// `poll` or `wait`, in the order of the calls to `read`.
+    /// When asynchronous readback is not supported, the pixels
+    /// are copied right away with `Texture::copyToImage`.
+    ///
+    /// To read the contents of a `sf::RenderTexture`, call its
+    /// `display` function first.
+    ///
+    /// \param texture Texture to read
+    ///
+    /// \return `true` if the readback was started, `false` if the
+    ///         texture is empty or all the buffers are in flight
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool read(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of readbacks in flight
+    ///
+    /// \return Number of readbacks started and not retrieved yet
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPendingCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the oldest readback if it is complete
+    ///
+    /// This function never waits for the graphics card.
+    ///
+    /// \return Pixels of the oldest pending readback, or `std::nullopt`
+    ///         if there is none or it is not complete yet
+    ///
+    /// \see `wait`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Image> poll();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the oldest readback, waiting for it if needed
+    ///
+    /// \return Pixels of the oldest pending readback, or `std::nullopt`
+    ///         if there is none
+    ///
+    /// \see `poll`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Image> wait();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the system supports asynchronous readback
+    ///
+    /// This requires pixel buffer objects and sync objects
+    /// (OpenGL 3.2 or the corresponding extensions). Without
+    /// them, `read` copies the pixels synchronously.
+    ///
+    /// \return `true` if asynchronous readback is supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Readback slot, holding the pixels of one texture
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Buffer;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Map the oldest pending readback and copy its pixels
+    ///
+    /// \return Pixels of the readback
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Image retrieve();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Buffer> m_buffers;        //!< Ring of readback slots
+    std::size_t         m_first{};        //!< Index of the oldest pending readback
+    std::size_t         m_pendingCount{}; //!< Number of readbacks in flight
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureReader
+/// \ingroup graphics
+///
+/// `sf::Texture::copyToImage` waits until the graphics card has
+/// finished rendering to the texture and transferred its pixels,
+/// which stalls the rendering pipeline. `sf::TextureReader` starts
+/// the transfer into a pixel buffer object instead, and only
+/// retrieves the pixels once a fence tells that the graphics card
+/// is done with them.
+///
+/// The reader owns a fixed number of buffers used as a ring:
+/// with 3 buffers, up to 3 readbacks can be in flight, e.g.
+/// frame N is retrieved while frames N+1 and N+2 are rendered.
+///
+/// Usage example:
+/// \code
+/// sf::RenderTexture renderTexture({256, 256});
+/// sf::TextureReader reader;
+///
+/// while (running)
+/// {
+///     renderTexture.clear();
+///     renderTexture.draw(scene);
+///     renderTexture.display();
+///
+///     // Start the transfer of this frame, skip it if all the buffers are busy
+///     if (!reader.read(renderTexture.getTexture()))
+///         ++droppedFrames;
+///
+///     // Save the frames that are ready
+///     while (const std::optional<sf::Image> frame = reader.poll())
+///         saveThumbnail(*frame);
+/// }
+/// \endcode
+///
+/// \see `sf::Texture`, `sf::RenderTexture`
+///
+////////////////////////////////////////////////////////////
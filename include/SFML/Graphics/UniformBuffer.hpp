@@ -0,0 +1,274 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Block of uniform data stored in graphics memory,
+///        which can be shared by several shaders
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API UniformBuffer : GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Usage specifiers
+    ///
+    /// If data is going to be updated once or more every frame,
+    /// set the usage to Stream. If data is going to be set once
+    /// and used for a long time without being modified, set the
+    /// usage to Static. For everything else Dynamic should be a
+    /// good compromise.
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Usage
+    {
+        Stream,  //!< Constantly changing data
+        Dynamic, //!< Occasionally changing data
+        Static   //!< Rarely changing data
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty uniform buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a `UniformBuffer` with a specific usage specifier
+    ///
+    /// Creates an empty uniform buffer and sets its usage to \p usage.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit UniformBuffer(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UniformBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(const UniformBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(UniformBuffer&& source) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(UniformBuffer&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the uniform buffer
+    ///
+    /// Creates the uniform buffer and allocates enough graphics
+    /// memory to hold \p size bytes. The contents of the buffer
+    /// are undefined until they are set with update().
+    ///
+    /// If this function is called multiple times, the buffer
+    /// will be recreated with the new size.
+    ///
+    /// \param size Size of the buffer, in bytes
+    ///
+    /// \return `true` if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the buffer, in bytes
+    ///
+    /// \return Size of the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of bytes
+    ///
+    /// \p data must point to \p size bytes laid out as expected
+    /// by the uniform blocks using the buffer (e.g. following the
+    /// \p std140 rules), and the updated range must be inside the
+    /// buffer.
+    ///
+    /// Updating the whole buffer lets the driver provide new
+    /// storage instead of waiting for the GPU to be done with
+    /// the previous contents, prefer it when the contents are
+    /// rewritten every frame.
+    ///
+    /// \param data   Pointer to the data to copy
+    /// \param size   Number of bytes to copy
+    /// \param offset Offset in the buffer to copy to, in bytes
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const void* data, std::size_t size, std::size_t offset = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the uniform buffer.
+    ///
+    /// You shouldn't need to use this function, unless you have
+    /// very specific stuff to implement that SFML doesn't support,
+    /// or implement a temporary workaround until a bug is fixed.
+    ///
+    /// \return OpenGL handle of the uniform buffer or 0 if not yet created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the usage specifier of this uniform buffer
+    ///
+    /// This function provides a hint about how this uniform buffer is
+    /// going to be used in terms of data update frequency.
+    ///
+    /// After changing the usage specifier, the uniform buffer has
+    /// to be updated with new data for the usage specifier to
+    /// take effect.
+    ///
+    /// The default usage type is `sf::UniformBuffer::Usage::Stream`.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUsage(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage specifier of this uniform buffer
+    ///
+    /// \return Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Usage getUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports uniform buffers
+    ///
+    /// This function should always be called before using
+    /// the uniform buffer features. If it returns `false`, then
+    /// any attempt to use `sf::UniformBuffer` will fail.
+    ///
+    /// \return `true` if uniform buffers are supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int m_buffer{};             //!< Internal buffer identifier
+    std::size_t  m_size{};               //!< Size of the buffer, in bytes
+    Usage        m_usage{Usage::Stream}; //!< How this uniform buffer is to be used
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UniformBuffer
+/// \ingroup graphics
+///
+/// `sf::UniformBuffer` stores the values of a GLSL uniform
+/// block in graphics memory. Unlike individual uniforms, which
+/// belong to a single shader, the same buffer can back blocks
+/// in any number of shaders: its contents are uploaded once,
+/// for example every frame, and all the shaders using it see
+/// the new values.
+///
+/// The layout of the data is described by the uniform block
+/// in GLSL. Declaring the block with the \p std140 layout makes
+/// it the same for every program and every driver:
+/// \code
+/// layout(std140) uniform Camera
+/// {
+///     mat4 viewProjection;
+///     vec4 position;
+/// };
+/// \endcode
+///
+/// The buffer is then assigned to the block of each shader with
+/// `sf::Shader::setUniformBlock()`, and updated with a structure
+/// that matches the layout of the block:
+/// \code
+/// struct Camera
+/// {
+///     std::array<float, 16> viewProjection;
+///     std::array<float, 4>  position;
+/// };
+///
+/// sf::UniformBuffer cameraBuffer;
+/// if (!cameraBuffer.create(sizeof(Camera)))
+///     return -1;
+///
+/// sceneShader.setUniformBlock("Camera", cameraBuffer);
+/// particleShader.setUniformBlock("Camera", cameraBuffer);
+///
+/// while (window.isOpen())
+/// {
+///     const Camera camera = ...;
+///     if (!cameraBuffer.update(&camera, sizeof(camera)))
+///         ...
+///     window.draw(scene, &sceneShader);
+///     window.draw(particles, &particleShader);
+/// }
+/// \endcode
+///
+/// Shaders keep a pointer to the buffers assigned to their
+/// blocks, the buffers must therefore outlive them.
+///
+/// \see `sf::Shader`
+///
+////////////////////////////////////////////////////////////
@@ -59,6 +59,16 @@ public:
     /// usage to Static. For everything else Dynamic should be a
     /// good compromise.
     ///
+    /// When the system supports it, every update of a Stream
+    /// buffer gives it fresh storage, so that the new vertices
+    /// are written without waiting for the GPU to finish drawing
+    /// the previous ones. Partial updates keep the rest of the
+    /// vertices by copying them on the GPU, which costs GPU
+    /// bandwidth proportional to the size of the whole buffer.
+    /// Without support for mapping buffer ranges and copying
+    /// between buffers, Stream buffers are updated like Dynamic
+    /// ones and may stall when the GPU is still using them.
+    ///
     ////////////////////////////////////////////////////////////
     enum class Usage
     {
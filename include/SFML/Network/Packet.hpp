@@ -98,6 +98,21 @@ public:
     ////////////////////////////////////////////////////////////
     void append(const void* data, std::size_t sizeInBytes);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve memory for the data of the packet
+    ///
+    /// Building a large packet value by value makes its storage
+    /// grow many times. If the final size is known in advance,
+    /// reserving it first avoids these reallocations.
+    /// This function doesn't change the size of the packet.
+    ///
+    /// \param sizeInBytes Total number of bytes to reserve
+    ///
+    /// \see `append`
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t sizeInBytes);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the current reading position in the packet
     ///
@@ -364,6 +379,231 @@ public:
     ////////////////////////////////////////////////////////////
     Packet& operator<<(const String& data);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read an array of values from the packet
+    ///
+    /// The values must have been written either with the
+    /// matching `write` overload or one by one with `operator<<`.
+    /// They are all extracted and converted from network byte
+    /// order in a single pass, which is much faster than reading
+    /// them one by one for large arrays.
+    /// If the packet doesn't hold \a count values, nothing is
+    /// read and the packet becomes invalid.
+    ///
+    /// \param data  Pointer to the array to fill
+    /// \param count Number of values to read
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `write`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& read(std::int8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(std::uint8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(std::int16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(std::uint16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(std::int32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(std::uint32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(std::int64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(std::uint64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(float* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& read(double* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an array of values into the packet
+    ///
+    /// The values are encoded exactly as if they were written
+    /// one by one with `operator<<`, but the packet grows once
+    /// and converts them to network byte order in a single pass.
+    /// The number of values is not written: send it separately
+    /// if the receiver doesn't know it in advance.
+    ///
+    /// \param data  Pointer to the values to write
+    /// \param count Number of values to write
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `read`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& write(const std::int8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const std::uint8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const std::int16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const std::uint16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const std::int32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const std::uint32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const std::int64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const std::uint64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const float* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& write(const double* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read an unsigned integer written by `writeVarUInt`
+    ///
+    /// \param data Variable to fill with the value
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `writeVarUInt`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readVarUInt(std::uint64_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read a signed integer written by `writeVarInt`
+    ///
+    /// \param data Variable to fill with the value
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `writeVarInt`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readVarInt(std::int64_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an unsigned integer with a variable-length encoding
+    ///
+    /// Each byte holds 7 bits of the value, so small values take
+    /// less room than with `operator<<`: values below 128 take a
+    /// single byte, and the largest ones take 10 bytes.
+    ///
+    /// \param data Value to write
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `readVarUInt`, `writeVarInt`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeVarUInt(std::uint64_t data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a signed integer with a variable-length encoding
+    ///
+    /// The value is zigzag-encoded first (0, -1, 1, -2, 2...
+    /// become 0, 1, 2, 3, 4...), so that values close to zero
+    /// take few bytes whatever their sign.
+    ///
+    /// \param data Value to write
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `readVarInt`, `writeVarUInt`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeVarInt(std::int64_t data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read a float written by `writeQuantized`
+    ///
+    /// \a min, \a max and \a bits must be the same as when the
+    /// value was written.
+    ///
+    /// \param data Variable to fill with the value
+    /// \param min  Minimum value of the range
+    /// \param max  Maximum value of the range
+    /// \param bits Number of bits of the quantized value, in [1, 32]
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `writeQuantized`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readQuantized(float& data, float min, float max, unsigned int bits);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a float quantized to a fixed number of bits
+    ///
+    /// The value is clamped to [\a min, \a max] and rounded to
+    /// the closest of 2^\a bits evenly spaced steps, which takes
+    /// \a bits / 8 bytes rounded up. For example, a coordinate in
+    /// a 1000 units wide world fits in 2 bytes with a precision
+    /// of about 0.015 units.
+    ///
+    /// \param data Value to write
+    /// \param min  Minimum value of the range
+    /// \param max  Maximum value of the range, greater than \a min
+    /// \param bits Number of bits of the quantized value, in [1, 32]
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `readQuantized`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeQuantized(float data, float min, float max, unsigned int bits);
+
 protected:
     friend class TcpSocket;
     friend class UdpSocket;
@@ -420,6 +660,30 @@ private:
     ////////////////////////////////////////////////////////////
     bool checkSize(std::size_t size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read an array of values in network byte order
+    ///
+    /// \param data  Pointer to the array to fill
+    /// \param count Number of values to read
+    ///
+    /// \return Reference to the packet
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    Packet& readArray(T* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an array of values in network byte order
+    ///
+    /// \param data  Pointer to the values to write
+    /// \param count Number of values to write
+    ///
+    /// \return Reference to the packet
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    Packet& writeArray(const T* data, std::size_t count);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -513,6 +777,12 @@ private:
 /// }
 /// \endcode
 ///
+/// Large or size-sensitive data can use dedicated functions:
+/// \li `write` and `read` to transfer whole arrays of numbers at once
+/// \li `writeVarUInt` and `writeVarInt` to store small integers in fewer bytes
+/// \li `writeQuantized` to store floats of a known range with a chosen precision
+/// \li `reserve` to build a large packet without repeated reallocations
+///
 /// Packets also provide an extra feature that allows to apply
 /// custom transformations to the data before it is sent,
 /// and after it is received. This is typically used to
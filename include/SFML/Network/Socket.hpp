@@ -180,15 +180,31 @@ protected:
     ////////////////////////////////////////////////////////////
     void close();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell selectors whether data already received by
+    ///        the socket is waiting to be extracted
+    ///
+    /// Such data doesn't make the system report the socket as
+    /// ready, so selectors check this state on the sockets that
+    /// were added to them and report them anyway. It is reset
+    /// when the socket is closed.
+    /// This function can only be accessed by derived classes.
+    ///
+    /// \param buffered `true` if data can be extracted without waiting
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBufferedData(bool buffered);
+
 private:
     friend class SocketSelector;
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    Type         m_type;             //!< Type of the socket (TCP or UDP)
-    SocketHandle m_socket;           //!< Socket descriptor
-    bool         m_isBlocking{true}; //!< Current blocking mode of the socket
+    Type         m_type;              //!< Type of the socket (TCP or UDP)
+    SocketHandle m_socket;            //!< Socket descriptor
+    bool         m_isBlocking{true};  //!< Current blocking mode of the socket
+    bool         m_hasBufferedData{}; //!< Is received data waiting to be extracted without the system knowing?
 };
 
 } // namespace sf
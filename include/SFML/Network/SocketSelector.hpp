@@ -32,6 +32,7 @@
 #include <SFML/System/Time.hpp>
 
 #include <memory>
+#include <vector>
 
 
 namespace sf
@@ -132,15 +133,18 @@ public:
     ///
     /// This function returns as soon as at least one socket has
     /// some data available to be received. To know which sockets are
-    /// ready, use the `isReady` function.
+    /// ready, use the `isReady` or `getReadySockets` functions.
     /// If you use a timeout and no socket is ready before the timeout
     /// is over, the function returns `false`.
+    /// TCP sockets holding complete packets which were already read
+    /// from the network are ready too, and make the function return
+    /// immediately.
     ///
     /// \param timeout Maximum time to wait, (use Time::Zero for infinity)
     ///
     /// \return `true` if there are sockets ready, `false` otherwise
     ///
-    /// \see `isReady`
+    /// \see `isReady`, `getReadySockets`
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool wait(Time timeout = Time::Zero);
@@ -164,6 +168,25 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isReady(Socket& socket) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sockets that are ready to receive data
+    ///
+    /// This function must be used after a call to `wait`. It
+    /// gives the same sockets as testing each of them with
+    /// `isReady`, but without visiting those that are not ready,
+    /// which matters when the selector contains many sockets.
+    ///
+    /// The pointers are the addresses of the sockets given to
+    /// `add`: if a socket is moved after being added, add it
+    /// again so that the selector knows its new address.
+    ///
+    /// \return Sockets that were ready after the last call to `wait`
+    ///
+    /// \see `wait`, `isReady`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::vector<Socket*>& getReadySockets() const;
+
 private:
     struct SocketSelectorImpl;
 
@@ -203,7 +226,15 @@ private:
 /// Using a selector is simple:
 /// \li populate the selector with all the sockets that you want to observe
 /// \li make it wait until there is data available on any of the sockets
-/// \li test each socket to find out which ones are ready
+/// \li test each socket to find out which ones are ready, or get
+///     the list of ready sockets with `getReadySockets`
+///
+/// On Linux, selectors are built on epoll: waiting costs time
+/// proportional to the number of ready sockets, not to the total
+/// number of sockets. Other Unix systems use poll. On these systems,
+/// the number of sockets and the values of their handles are not
+/// limited. On Windows, a selector can't contain more than FD_SETSIZE
+/// sockets.
 ///
 /// Usage example:
 /// \code
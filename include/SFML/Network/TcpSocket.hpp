@@ -37,7 +37,6 @@
 #include <vector>
 
 #include <cstddef>
-#include <cstdint>
 
 
 namespace sf
@@ -167,6 +166,9 @@ public:
     ///
     /// In blocking mode, this function will wait until some
     /// bytes are actually received.
+    /// Bytes which were already read from the network by a
+    /// previous packet receive, but not extracted as a packet
+    /// yet, are returned first.
     /// This function will fail if the socket is not connected.
     ///
     /// \param data     Pointer to the array to fill with the received bytes
@@ -198,12 +200,39 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status send(Packet& packet);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several formatted packets to the remote peer
+    ///
+    /// The packets are handed to the system together, in as
+    /// few calls as possible, without being copied into an
+    /// intermediate buffer. This is much cheaper than sending
+    /// many small packets one at a time.
+    ///
+    /// In non-blocking mode, if this function returns `sf::Socket::Status::Partial`,
+    /// the first \a sent packets were completely sent, and you \em must
+    /// retry sending the remaining unmodified packets (starting at
+    /// `packets + sent`) before sending anything else in order to
+    /// guarantee they arrive at the remote peer uncorrupted.
+    /// This function will fail if the socket is not connected.
+    ///
+    /// \param packets Array of packets to send
+    /// \param count   Number of packets in the array
+    /// \param sent    The number of packets completely sent will be written here
+    ///
+    /// \return Status code
+    ///
+    /// \see `receive`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status send(Packet* packets, std::size_t count, std::size_t& sent);
+
     ////////////////////////////////////////////////////////////
     /// \brief Receive a formatted packet of data from the remote peer
     ///
     /// In blocking mode, this function will wait until the whole packet
     /// has been received.
-    /// This function will fail if the socket is not connected.
+    /// This function will fail if the socket is not connected,
+    /// or if the packet is larger than 1 GiB.
     ///
     /// \param packet Packet to fill with the received data
     ///
@@ -214,25 +243,75 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status receive(Packet& packet);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive several formatted packets from the remote peer
+    ///
+    /// The socket reads incoming bytes into an internal buffer,
+    /// as many as are available at once, so a single wake-up
+    /// usually yields several packets. This function waits (in
+    /// blocking mode) until at least one packet is complete, then
+    /// extracts every complete packet already buffered, up to
+    /// \a count, without reading from the network again.
+    /// This function will fail if the socket is not connected,
+    /// or if a packet is larger than 1 GiB.
+    ///
+    /// \param packets  Array of packets to fill with the received data
+    /// \param count    Number of packets in the array
+    /// \param received The number of packets filled will be written here
+    ///
+    /// \return Status code
+    ///
+    /// \see `send`, `hasPendingPacket`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status receive(Packet* packets, std::size_t count, std::size_t& received);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a complete packet is already buffered
+    ///
+    /// Packets which were read from the network but not
+    /// extracted yet are reported as ready by
+    /// `sf::SocketSelector`. Without a selector, use this
+    /// function to know whether the next call to `receive`
+    /// will return a packet immediately, without waiting
+    /// for the network.
+    ///
+    /// \return `true` if a complete packet is buffered
+    ///
+    /// \see `receive`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool hasPendingPacket() const;
+
 private:
     friend class TcpListener;
 
     ////////////////////////////////////////////////////////////
-    /// \brief Structure holding the data of a pending packet
+    /// \brief Read available bytes into the receive buffer
+    ///
+    /// The buffer grows as the bytes of a large packet arrive,
+    /// packets declaring a size above the limit are rejected.
+    ///
+    /// \return Status code
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status fillReceiveBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Structure holding the bytes received but not extracted yet
     ///
     ////////////////////////////////////////////////////////////
-    struct PendingPacket
+    struct ReceiveBuffer
     {
-        std::uint32_t          size{};         //!< Data of packet size
-        std::size_t            sizeReceived{}; //!< Number of size bytes received so far
-        std::vector<std::byte> data;           //!< Data of the packet
+        std::vector<std::byte> data;    //!< Storage of the received bytes
+        std::size_t            begin{}; //!< Offset of the first byte not extracted yet
+        std::size_t            end{};   //!< Offset past the last byte received
     };
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    PendingPacket          m_pendingPacket;     //!< Temporary data of the packet currently being received
-    std::vector<std::byte> m_blockToSendBuffer; //!< Buffer used to prepare data being sent from the socket
+    ReceiveBuffer m_receiveBuffer; //!< Bytes read from the network which were not extracted yet
 };
 
 } // namespace sf
@@ -55,6 +55,34 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static constexpr std::size_t MaxDatagramSize{65507}; //!< The maximum number of bytes that can be sent in a single UDP datagram
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Datagram to send with `send(const OutgoingDatagram*, std::size_t, std::size_t&)`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct OutgoingDatagram
+    {
+        const void*    data{};                        //!< Pointer to the sequence of bytes to send
+        std::size_t    size{};                        //!< Number of bytes to send
+        IpAddress      remoteAddress{IpAddress::Any}; //!< Address of the receiver
+        unsigned short remotePort{};                  //!< Port of the receiver to send the data to
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Datagram to fill with `receive(IncomingDatagram*, std::size_t, std::size_t&)`
+    ///
+    /// `data` and `size` describe the buffer provided by the caller,
+    /// the other members are filled when a datagram is received.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct IncomingDatagram
+    {
+        void*                    data{};        //!< Pointer to the array to fill with the received bytes
+        std::size_t              size{};        //!< Maximum number of bytes that can be received
+        std::size_t              received{};    //!< Actual number of bytes received
+        std::optional<IpAddress> remoteAddress; //!< Address of the peer that sent the data
+        unsigned short           remotePort{};  //!< Port of the peer that sent the data
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -194,6 +222,56 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status receive(Packet& packet, std::optional<IpAddress>& remoteAddress, unsigned short& remotePort);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several datagrams to remote peers
+    ///
+    /// The datagrams are handed to the system in as few calls
+    /// as possible (a single `sendmmsg` call per batch on Linux),
+    /// which is much cheaper than sending them one at a time.
+    /// They are sent in order. If one of them can't be sent,
+    /// the function stops and returns the corresponding status;
+    /// in non-blocking mode, `sf::Socket::Status::Partial` means
+    /// that the system buffers are full after the first \a sent
+    /// datagrams.
+    ///
+    /// Make sure that no datagram is bigger than
+    /// `UdpSocket::MaxDatagramSize`, otherwise this function will
+    /// fail and no data will be sent.
+    ///
+    /// \param datagrams Array of datagrams to send
+    /// \param count     Number of datagrams in the array
+    /// \param sent      The number of datagrams sent will be written here
+    ///
+    /// \return Status code
+    ///
+    /// \see `receive`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status send(const OutgoingDatagram* datagrams, std::size_t count, std::size_t& sent);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive several datagrams from remote peers
+    ///
+    /// In blocking mode, this function waits until at least one
+    /// datagram is received. It then takes the datagrams which
+    /// are already queued, up to \a count, without waiting any
+    /// longer. On Linux they are received with `recvmmsg`, in as
+    /// few calls as possible.
+    /// As with the single datagram version, be careful to provide
+    /// buffers which are large enough for the data that you
+    /// intend to receive.
+    ///
+    /// \param datagrams Array of datagrams to fill
+    /// \param count     Number of datagrams in the array
+    /// \param received  The number of datagrams filled will be written here
+    ///
+    /// \return Status code
+    ///
+    /// \see `send`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status receive(IncomingDatagram* datagrams, std::size_t count, std::size_t& received);
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -243,6 +321,12 @@ private:
 /// of the protocol (dropped, mixed or duplicated datagrams may
 /// lead to a big mess when trying to recompose a packet).
 ///
+/// Servers exchanging many small datagrams can send and
+/// receive them in batches, with the `send` and `receive`
+/// overloads taking arrays of `OutgoingDatagram` and
+/// `IncomingDatagram`. On Linux each batch costs a single
+/// system call instead of one per datagram.
+///
 /// If the socket is bound to a port, it is automatically
 /// unbound from it when the socket is destroyed. However,
 /// you can unbind the socket explicitly with the Unbind
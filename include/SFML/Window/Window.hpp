@@ -338,6 +338,17 @@ public:
     ////////////////////////////////////////////////////////////
     void display();
 
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called before the window is displayed
+    ///
+    /// This function is called so that derived classes can
+    /// finish their rendering before the frame is shown on
+    /// screen. The window is active when it is called.
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void onDisplay();
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Perform some common internal initializations
@@ -43,7 +43,12 @@
 #include FT_BITMAP_H
 #include FT_STROKER_H
 
+#include <algorithm>
+#include <memory>
 #include <ostream>
+#include <set>
+#include <system_error>
+#include <thread>
 #include <utility>
 
 #include <cmath>
@@ -79,11 +84,210 @@ inline T reinterpret(const U& input)
     return output;
 }
 
+// Threads that are joined when they go out of scope, even if an exception is thrown while they run
+struct WorkerThreads
+{
+    ~WorkerThreads()
+    {
+        join();
+    }
+
+    void join()
+    {
+        for (std::thread& thread : threads)
+        {
+            if (thread.joinable())
+                thread.join();
+        }
+    }
+
+    std::vector<std::thread> threads;
+};
+
 // Combine outline thickness, boldness and font glyph index into a single 64-bit key
 std::uint64_t combine(float outlineThickness, bool bold, std::uint32_t index)
 {
     return (std::uint64_t{reinterpret<std::uint32_t>(outlineThickness)} << 32) | (std::uint64_t{bold} << 31) | index;
 }
+
+// Make sure that the given size is the current one of a font face
+bool setPixelSize(FT_Face face, unsigned int characterSize)
+{
+    // FT_Set_Pixel_Sizes is an expensive function, so we must call it
+    // only when necessary to avoid killing performances
+
+    const FT_UShort currentSize = face->size->metrics.x_ppem;
+
+    if (currentSize != characterSize)
+    {
+        const FT_Error result = FT_Set_Pixel_Sizes(face, 0, characterSize);
+
+        if (result == FT_Err_Invalid_Pixel_Size)
+        {
+            // In the case of bitmap fonts, resizing can
+            // fail if the requested size is not available
+            if (!FT_IS_SCALABLE(face))
+            {
+                sf::err() << "Failed to set bitmap font size to " << characterSize << '\n' << "Available sizes are: ";
+                for (int i = 0; i < face->num_fixed_sizes; ++i)
+                {
+                    const long size = (face->available_sizes[i].y_ppem + 32) >> 6;
+                    sf::err() << size << " ";
+                }
+                sf::err() << std::endl;
+            }
+            else
+            {
+                sf::err() << "Failed to set font size to " << characterSize << std::endl;
+            }
+        }
+
+        return result == FT_Err_Ok;
+    }
+
+    return true;
+}
+
+// Leave a small padding around characters, so that filtering doesn't
+// pollute them with pixels from neighbors
+constexpr unsigned int glyphPadding = 2;
+
+// Compute the squared euclidean distance transform of a line of a grid, in place
+// (P. Felzenszwalb and D. Huttenlocher, "Distance Transforms of Sampled Functions")
+void distanceTransform(float*                    grid,
+                       std::size_t               stride,
+                       std::size_t               length,
+                       std::vector<float>&       f,
+                       std::vector<float>&       z,
+                       std::vector<std::size_t>& v)
+{
+    constexpr float infinity = 1e20f;
+
+    for (std::size_t q = 0; q < length; ++q)
+        f[q] = grid[q * stride];
+
+    // Compute the lower envelope of the parabolas rooted at each sample
+    std::size_t k = 0;
+    v[0]          = 0;
+    z[0]          = -infinity;
+    z[1]          = infinity;
+    for (std::size_t q = 1; q < length; ++q)
+    {
+        const auto qf = static_cast<float>(q);
+        float      s  = 0.f;
+        while (true)
+        {
+            const auto rf = static_cast<float>(v[k]);
+            s             = (f[q] - f[v[k]] + qf * qf - rf * rf) / (qf - rf) / 2.f;
+            if ((s > z[k]) || (k == 0))
+                break;
+            --k;
+        }
+
+        ++k;
+        v[k]     = q;
+        z[k]     = s;
+        z[k + 1] = infinity;
+    }
+
+    // Sample the envelope
+    k = 0;
+    for (std::size_t q = 0; q < length; ++q)
+    {
+        while (z[k + 1] < static_cast<float>(q))
+            ++k;
+
+        const float offset = static_cast<float>(q) - static_cast<float>(v[k]);
+        grid[q * stride]   = f[v[k]] + offset * offset;
+    }
+}
+
+// Compute the squared euclidean distance transform of a 2D grid, in place
+void distanceTransform(std::vector<float>& grid, std::size_t width, std::size_t height)
+{
+    const std::size_t        length = std::max(width, height);
+    std::vector<float>       f(length);
+    std::vector<float>       z(length + 1);
+    std::vector<std::size_t> v(length);
+
+    for (std::size_t x = 0; x < width; ++x)
+        distanceTransform(grid.data() + x, width, height, f, z, v);
+
+    for (std::size_t y = 0; y < height; ++y)
+        distanceTransform(grid.data() + y * width, 1, width, f, z, v);
+}
+
+// Compute the signed distance field of a rasterized glyph, with a margin of `spread` pixels around it;
+// distances are mapped to [0, 255] so that 128 is on the edge and values increase inside the glyph
+std::vector<std::uint8_t> computeDistanceField(const FT_Bitmap& bitmap, unsigned int spread)
+{
+    constexpr float infinity = 1e20f;
+
+    const std::size_t width  = std::size_t{bitmap.width} + 2 * spread;
+    const std::size_t height = std::size_t{bitmap.rows} + 2 * spread;
+
+    // Seed the distances to the outside and to the inside of the glyph, using the coverage of
+    // the edge pixels to estimate where the edge crosses them (as done by TinySDF)
+    std::vector<float> outside(width * height, infinity);
+    std::vector<float> inside(width * height, 0.f);
+
+    const std::uint8_t* pixels = bitmap.buffer;
+    for (std::size_t y = 0; y < bitmap.rows; ++y)
+    {
+        for (std::size_t x = 0; x < bitmap.width; ++x)
+        {
+            float coverage = 0.f;
+            if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+                coverage = (pixels[x / 8] & (1 << (7 - (x % 8)))) ? 1.f : 0.f;
+            else
+                coverage = static_cast<float>(pixels[x]) / 255.f;
+
+            const std::size_t index = (x + spread) + (y + spread) * width;
+            if (coverage >= 1.f)
+            {
+                outside[index] = 0.f;
+                inside[index]  = infinity;
+            }
+            else if (coverage > 0.f)
+            {
+                const float distance = 0.5f - coverage;
+                outside[index]       = distance > 0.f ? distance * distance : 0.f;
+                inside[index]        = distance < 0.f ? distance * distance : 0.f;
+            }
+        }
+        pixels += bitmap.pitch;
+    }
+
+    distanceTransform(outside, width, height);
+    distanceTransform(inside, width, height);
+
+    std::vector<std::uint8_t> field(width * height);
+    for (std::size_t i = 0; i < field.size(); ++i)
+    {
+        const float distance = std::sqrt(outside[i]) - std::sqrt(inside[i]);
+        const float value    = 255.f * (0.5f - distance / (2.f * static_cast<float>(spread)));
+        field[i]             = static_cast<std::uint8_t>(std::clamp(std::round(value), 0.f, 255.f));
+    }
+
+    return field;
+}
+
+// Copy a rectangle of RGBA pixels between two buffers, given the width of their rows in pixels
+void copyPixels(const std::uint8_t* source,
+                unsigned int        sourceWidth,
+                sf::Vector2u        sourcePosition,
+                std::uint8_t*       dest,
+                unsigned int        destWidth,
+                sf::Vector2u        destPosition,
+                sf::Vector2u        size)
+{
+    for (unsigned int y = 0; y < size.y; ++y)
+    {
+        const std::size_t sourceOffset = (std::size_t{sourcePosition.y + y} * sourceWidth + sourcePosition.x) * 4;
+        const std::size_t destOffset   = (std::size_t{destPosition.y + y} * destWidth + destPosition.x) * 4;
+        std::memcpy(dest + destOffset, source + sourceOffset, std::size_t{size.x} * 4);
+    }
+}
 } // namespace
 
 
@@ -114,10 +318,51 @@ struct Font::FontHandles
     FontHandles& operator=(FontHandles&&) = delete;
     // clang-format on
 
-    FT_Library   library{};   //< Pointer to the internal library interface
-    FT_StreamRec streamRec{}; //< Stream rec object describing an input stream
-    FT_Face      face{};      //< Pointer to the internal font face
-    FT_Stroker   stroker{};   //< Pointer to the stroker
+    // Open another instance of the same font, to be used by another thread
+    // (fonts opened from a stream can't be opened again, since the stream can only be read by one thread)
+    [[nodiscard]] std::unique_ptr<FontHandles> duplicate() const
+    {
+        if (filename.empty() && !data)
+            return nullptr;
+
+        auto handles = std::make_unique<FontHandles>();
+
+        if (FT_Init_FreeType(&handles->library) != 0)
+            return nullptr;
+
+        FT_Face newFace = nullptr;
+        if (!filename.empty())
+        {
+            if (FT_New_Face(handles->library, filename.string().c_str(), 0, &newFace) != 0)
+                return nullptr;
+        }
+        else if (FT_New_Memory_Face(handles->library,
+                                    reinterpret_cast<const FT_Byte*>(data),
+                                    static_cast<FT_Long>(dataSize),
+                                    0,
+                                    &newFace) != 0)
+        {
+            return nullptr;
+        }
+        handles->face = newFace;
+
+        if ((FT_Stroker_New(handles->library, &handles->stroker) != 0) ||
+            (FT_Select_Charmap(newFace, FT_ENCODING_UNICODE) != 0))
+            return nullptr;
+
+        handles->filename = filename;
+        handles->data     = data;
+        handles->dataSize = dataSize;
+        return handles;
+    }
+
+    FT_Library            library{};   //< Pointer to the internal library interface
+    FT_StreamRec          streamRec{}; //< Stream rec object describing an input stream
+    FT_Face               face{};      //< Pointer to the internal font face
+    FT_Stroker            stroker{};   //< Pointer to the stroker
+    std::filesystem::path filename;    //< Path of the font file, if the font was opened from a file
+    const void*           data{};      //< Font file data, if the font was opened from memory
+    std::size_t           dataSize{};  //< Size of the font file data, in bytes
 };
 
 
@@ -189,7 +434,8 @@ bool Font::openFromFile(const std::filesystem::path& filename)
     }
 
     // Store the loaded font handles
-    m_fontHandles = std::move(fontHandles);
+    fontHandles->filename = filename;
+    m_fontHandles         = std::move(fontHandles);
 
     // Store the font information
     m_info.family = face->family_name ? face->family_name : std::string();
@@ -250,7 +496,9 @@ bool Font::openFromMemory(const void* data, std::size_t sizeInBytes)
     }
 
     // Store the loaded font handles
-    m_fontHandles = std::move(fontHandles);
+    fontHandles->data     = data;
+    fontHandles->dataSize = sizeInBytes;
+    m_fontHandles         = std::move(fontHandles);
 
     // Store the font information
     m_info.family = face->family_name ? face->family_name : std::string();
@@ -341,23 +589,50 @@ const Font::Info& Font::getInfo() const
 const Glyph& Font::getGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
 {
     // Get the page corresponding to the character size
-    GlyphTable& glyphs = loadPage(characterSize).glyphs;
+    Page& page = loadPage(characterSize);
+
+    // Distance field glyphs produce their outline from the same field as the fill
+    if (m_isDistanceField)
+        outlineThickness = 0.f;
 
     // Build the key by combining the glyph index (based on code point), bold flag, and outline thickness
     const std::uint64_t key = combine(outlineThickness,
                                       bold,
                                       FT_Get_Char_Index(m_fontHandles ? m_fontHandles->face : nullptr, codePoint));
 
-    // Search the glyph into the cache
-    if (const auto it = glyphs.find(key); it != glyphs.end())
+    // Search the glyph into the cache, and mark it as recently used
+    GlyphTable& glyphs           = page.glyphs[characterSize];
+    const auto [entry, inserted] = glyphs.try_emplace(key);
+
+    CachedGlyph& cachedGlyph = entry->second;
+    cachedGlyph.lastUse      = ++page.useCounter;
+
+    // Found: return it
+    if (!inserted && !cachedGlyph.evicted)
+        return cachedGlyph.glyph;
+
+    // Not found or evicted: we have to load it (evicted glyphs keep their entry, so that references to them stay valid)
+    Glyph glyph;
+    if (m_isDistanceField && (characterSize != DistanceFieldCharacterSize))
     {
-        // Found: just return it
-        return it->second;
+        // Distance fields are only rasterized at the reference size, scale its metrics
+        glyph = getGlyph(codePoint, DistanceFieldCharacterSize, bold);
+
+        const float scale = static_cast<float>(characterSize) / static_cast<float>(DistanceFieldCharacterSize);
+        glyph.advance *= scale;
+        glyph.bounds.position *= scale;
+        glyph.bounds.size *= scale;
+        glyph.lsbDelta = static_cast<int>(std::lround(static_cast<float>(glyph.lsbDelta) * scale));
+        glyph.rsbDelta = static_cast<int>(std::lround(static_cast<float>(glyph.rsbDelta) * scale));
+    }
+    else
+    {
+        glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness);
     }
 
-    // Not found: we have to load it
-    const Glyph glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness);
-    return glyphs.try_emplace(key, glyph).first->second;
+    cachedGlyph.glyph   = glyph;
+    cachedGlyph.evicted = false;
+    return cachedGlyph.glyph;
 }
 
 
@@ -483,6 +758,252 @@ bool Font::isSmooth() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Font::setMaximumTextureSize(unsigned int size)
+{
+    m_maximumTextureSize = size;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int Font::getMaximumTextureSize() const
+{
+    return m_maximumTextureSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::setAtlasShared(bool shared)
+{
+    if (shared != m_isAtlasShared)
+    {
+        m_isAtlasShared = shared;
+
+        // The glyphs are stored in pages that don't match the new layout anymore
+        m_pages.clear();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::isAtlasShared() const
+{
+    return m_isAtlasShared;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::setDistanceFieldEnabled(bool enabled)
+{
+    if (enabled != m_isDistanceField)
+    {
+        m_isDistanceField = enabled;
+
+        // The glyphs are stored in pages that don't match the new layout anymore
+        m_pages.clear();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::isDistanceFieldEnabled() const
+{
+    return m_isDistanceField;
+}
+
+
+////////////////////////////////////////////////////////////
+Font::AtlasStatistics Font::getAtlasStatistics(unsigned int characterSize) const
+{
+    // Don't create the page just to inspect it
+    const auto it = m_pages.find(getPageKey(characterSize));
+    if (it == m_pages.end())
+        return {};
+
+    const Page& page = it->second;
+
+    AtlasStatistics statistics;
+    statistics.textureSize = page.texture.getSize();
+    for (const auto& [size, glyphs] : page.glyphs)
+    {
+        // Scaled distance field glyphs share the texture rectangle of the reference size
+        if (m_isDistanceField && (size != DistanceFieldCharacterSize))
+            continue;
+
+        statistics.glyphCount += static_cast<std::size_t>(
+            std::count_if(glyphs.begin(),
+                          glyphs.end(),
+                          [](const auto& entry) { return entry.second.glyph.textureRect.size.x > 0; }));
+    }
+    statistics.evictions = page.evictions;
+    statistics.regrowths = page.regrowths;
+
+    const std::uint64_t textureArea = std::uint64_t{statistics.textureSize.x} * std::uint64_t{statistics.textureSize.y};
+    if (textureArea > 0)
+        statistics.occupancy = static_cast<float>(page.packedArea) / static_cast<float>(textureArea);
+
+    return statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Font::preload(const std::vector<CodePointRange>& ranges,
+                          const std::vector<unsigned int>&   characterSizes,
+                          const std::vector<GlyphStyle>&     styles)
+{
+    // Stop if no font is loaded
+    if (!m_fontHandles || !m_fontHandles->face)
+        return 0;
+
+    const std::vector<GlyphStyle> regularStyle(1);
+    const auto&                   glyphStyles = styles.empty() ? regularStyle : styles;
+
+    // A glyph to rasterize, and where to store it
+    struct Job
+    {
+        std::uint32_t   codePoint{};
+        unsigned int    characterSize{};
+        bool            bold{};
+        float           outlineThickness{};
+        std::uint64_t   key{};
+        RasterizedGlyph rasterizedGlyph;
+    };
+
+    // List the glyphs that are not loaded yet; distance field glyphs are only rasterized at the
+    // reference size, the other sizes are derived from it when requested
+    std::vector<Job>                                 jobs;
+    std::set<std::pair<unsigned int, std::uint64_t>> queued;
+    for (const unsigned int requestedSize : characterSizes)
+    {
+        const unsigned int characterSize = m_isDistanceField ? DistanceFieldCharacterSize : requestedSize;
+        const GlyphTable&  glyphs        = loadPage(characterSize).glyphs[characterSize];
+
+        for (const GlyphStyle& style : glyphStyles)
+        {
+            const float outlineThickness = m_isDistanceField ? 0.f : style.outlineThickness;
+
+            for (const CodePointRange& range : ranges)
+            {
+                for (std::uint64_t codePoint = range.first; codePoint <= range.last; ++codePoint)
+                {
+                    const auto          point = static_cast<std::uint32_t>(codePoint);
+                    const std::uint64_t key   = combine(outlineThickness,
+                                                      style.bold,
+                                                      FT_Get_Char_Index(m_fontHandles->face, point));
+
+                    const auto entry = glyphs.find(key);
+                    if (((entry == glyphs.end()) || entry->second.evicted) && queued.emplace(characterSize, key).second)
+                        jobs.push_back({point, characterSize, style.bold, outlineThickness, key, {}});
+                }
+            }
+        }
+    }
+
+    // Rasterize the glyphs in slices, so that the pixels of a huge request don't all stay in memory at once
+    constexpr std::size_t sliceSize   = 1024;
+    const std::size_t     threadCount = std::max(std::size_t{std::thread::hardware_concurrency()}, std::size_t{1});
+
+    // FreeType faces can't be shared between threads: each worker opens its own instance of the font, once for
+    // all the slices (the calling thread rasterizes the first chunk of each slice with the font's own handles)
+    std::vector<std::unique_ptr<FontHandles>> workerHandles(threadCount);
+
+    for (std::size_t sliceBegin = 0; sliceBegin < jobs.size(); sliceBegin += sliceSize)
+    {
+        const std::size_t sliceEnd   = std::min(sliceBegin + sliceSize, jobs.size());
+        const std::size_t chunkCount = std::min(threadCount, sliceEnd - sliceBegin);
+
+        const auto rasterizeChunk = [&](FontHandles& handles, std::size_t chunk)
+        {
+            const std::size_t chunkBegin = sliceBegin + (sliceEnd - sliceBegin) * chunk / chunkCount;
+            const std::size_t chunkEnd   = sliceBegin + (sliceEnd - sliceBegin) * (chunk + 1) / chunkCount;
+
+            for (std::size_t i = chunkBegin; i < chunkEnd; ++i)
+            {
+                Job& job = jobs[i];
+                rasterizeGlyph(handles,
+                               job.codePoint,
+                               job.characterSize,
+                               job.bold,
+                               job.outlineThickness,
+                               job.rasterizedGlyph);
+            }
+        };
+
+        // The chunks whose worker couldn't be started, open the font or finish are rasterized by the calling thread
+        WorkerThreads             workers;
+        std::vector<std::uint8_t> rasterized(chunkCount, false);
+        workers.threads.reserve(chunkCount - 1);
+        try
+        {
+            for (std::size_t chunk = 1; chunk < chunkCount; ++chunk)
+            {
+                workers.threads.emplace_back(
+                    [&, chunk]
+                    {
+                        std::unique_ptr<FontHandles>& handles = workerHandles[chunk];
+                        try
+                        {
+                            if (!handles)
+                                handles = m_fontHandles->duplicate();
+
+                            if (handles)
+                            {
+                                rasterizeChunk(*handles, chunk);
+                                rasterized[chunk] = true;
+                            }
+                        }
+                        catch (...)
+                        {
+                            // An exception can't leave the thread: let the calling thread rasterize the chunk,
+                            // and open the font again for the next slice in case the handles were left unusable
+                            handles.reset();
+                        }
+                    });
+            }
+        }
+        catch (const std::system_error&)
+        {
+            // No more threads available, use the ones started so far
+        }
+
+        rasterizeChunk(*m_fontHandles, 0);
+
+        workers.join();
+
+        for (std::size_t chunk = 1; chunk < chunkCount; ++chunk)
+        {
+            if (!rasterized[chunk])
+                rasterizeChunk(*m_fontHandles, chunk);
+        }
+
+        // Pack all the rasterized glyphs, then update the area of each texture that received some at once
+        for (std::size_t i = sliceBegin; i < sliceEnd; ++i)
+        {
+            Job&  job  = jobs[i];
+            Page& page = loadPage(job.characterSize);
+            page.loadPixels();
+            const Glyph glyph = storeGlyph(job.rasterizedGlyph, job.characterSize);
+            page.glyphs[job.characterSize].insert_or_assign(job.key, CachedGlyph{glyph, ++page.useCounter});
+
+            // Release the pixels as soon as they are in the copy of the texture
+            std::vector<std::uint8_t>().swap(job.rasterizedGlyph.pixels);
+        }
+
+        for (auto& [key, page] : m_pages)
+            page.uploadPixels();
+    }
+
+    // The pages that never evicted glyphs only needed their copy of the pixels for this call
+    for (auto& [key, page] : m_pages)
+    {
+        if (!page.keepPixels)
+            std::vector<std::uint8_t>().swap(page.pixels);
+    }
+
+    return jobs.size();
+}
+
+
 ////////////////////////////////////////////////////////////
 void Font::cleanup()
 {
@@ -498,40 +1019,73 @@ void Font::cleanup()
 ////////////////////////////////////////////////////////////
 Font::Page& Font::loadPage(unsigned int characterSize) const
 {
-    return m_pages.try_emplace(characterSize, m_isSmooth).first->second;
+    return m_pages.try_emplace(getPageKey(characterSize), m_isSmooth).first->second;
 }
 
 
 ////////////////////////////////////////////////////////////
-Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
+unsigned int Font::getPageKey(unsigned int characterSize) const
 {
-    // The glyph to return
-    Glyph glyph;
+    // Shared textures and distance fields store all the character sizes in the same page
+    return (m_isAtlasShared || m_isDistanceField) ? 0u : characterSize;
+}
+
 
+////////////////////////////////////////////////////////////
+Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
+{
     // Stop if no font is loaded
-    if (!m_fontHandles)
-        return glyph;
+    if (!m_fontHandles || !m_fontHandles->face)
+        return {};
+
+    // Reuse the pixel buffer of the previous glyphs
+    RasterizedGlyph rasterizedGlyph;
+    rasterizedGlyph.pixels.swap(m_pixelBuffer);
+
+    rasterizeGlyph(*m_fontHandles, codePoint, characterSize, bold, outlineThickness, rasterizedGlyph);
+    const Glyph glyph = storeGlyph(rasterizedGlyph, characterSize);
+
+    // The glyph can be drawn as soon as it is returned
+    if ((rasterizedGlyph.size.x > 0) && (rasterizedGlyph.size.y > 0))
+        loadPage(characterSize).uploadPixels();
+
+    m_pixelBuffer.swap(rasterizedGlyph.pixels);
+    return glyph;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::rasterizeGlyph(FontHandles&     handles,
+                          std::uint32_t    codePoint,
+                          unsigned int     characterSize,
+                          bool             bold,
+                          float            outlineThickness,
+                          RasterizedGlyph& output) const
+{
+    // The glyph to return
+    output.glyph = Glyph();
+    output.size  = Vector2u();
 
     // Get our FT_Face
-    FT_Face face = m_fontHandles->face;
+    FT_Face face = handles.face;
     if (!face)
-        return glyph;
+        return;
 
     // Set the character size
-    if (!setCurrentSize(characterSize))
-        return glyph;
+    if (!setPixelSize(face, characterSize))
+        return;
 
     // Load the glyph corresponding to the code point
     FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
     if (outlineThickness != 0)
         flags |= FT_LOAD_NO_BITMAP;
     if (FT_Load_Char(face, codePoint, flags) != 0)
-        return glyph;
+        return;
 
     // Retrieve the glyph
     FT_Glyph glyphDesc = nullptr;
     if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
-        return glyph;
+        return;
 
     // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
     const FT_Pos weight  = 1 << 6;
@@ -546,7 +1100,7 @@ Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool
 
         if (outlineThickness != 0)
         {
-            FT_Stroker stroker = m_fontHandles->stroker;
+            FT_Stroker stroker = handles.stroker;
 
             FT_Stroker_Set(stroker,
                            static_cast<FT_Fixed>(outlineThickness * float{1 << 6}),
@@ -568,13 +1122,14 @@ Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool
     if (!outline)
     {
         if (bold)
-            FT_Bitmap_Embolden(m_fontHandles->library, &bitmap, weight, weight);
+            FT_Bitmap_Embolden(handles.library, &bitmap, weight, weight);
 
         if (outlineThickness != 0)
             err() << "Failed to outline glyph (no fallback available)" << std::endl;
     }
 
     // Compute the glyph's advance offset
+    Glyph& glyph  = output.glyph;
     glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
     if (bold)
         glyph.advance += static_cast<float>(weight) / float{1 << 6};
@@ -586,31 +1141,20 @@ Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool
 
     if ((size.x > 0) && (size.y > 0))
     {
-        // Leave a small padding around characters, so that filtering doesn't
-        // pollute them with pixels from neighbors
-        const unsigned int padding = 2;
+        // Distance fields extend beyond the glyph's bounds, up to the spread
+        const unsigned int padding = getGlyphPadding();
 
         size += 2u * Vector2u(padding, padding);
 
-        // Get the glyphs page corresponding to the character size
-        Page& page = loadPage(characterSize);
-
-        // Find a good position for the new glyph into the texture
-        glyph.textureRect = findGlyphRect(page, size);
-
-        // Make sure the texture data is positioned in the center
-        // of the allocated texture rectangle
-        glyph.textureRect.position += Vector2i(padding, padding);
-        glyph.textureRect.size -= 2 * Vector2i(padding, padding);
-
         // Compute the glyph's bounding box
         glyph.bounds.position = Vector2f(Vector2i(bitmapGlyph->left, -bitmapGlyph->top));
         glyph.bounds.size     = Vector2f(Vector2u(bitmap.width, bitmap.rows));
 
         // Resize the pixel buffer to the new size and fill it with transparent white pixels
-        m_pixelBuffer.resize(std::size_t{size.x} * std::size_t{size.y} * 4);
+        std::vector<std::uint8_t>& pixelBuffer = output.pixels;
+        pixelBuffer.resize(std::size_t{size.x} * std::size_t{size.y} * 4);
 
-        std::uint8_t* current = m_pixelBuffer.data();
+        std::uint8_t* current = pixelBuffer.data();
         std::uint8_t* end     = current + size.x * size.y * 4;
 
         while (current != end)
@@ -623,7 +1167,22 @@ Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool
 
         // Extract the glyph's pixels from the bitmap
         const std::uint8_t* pixels = bitmap.buffer;
-        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+        if (m_isDistanceField)
+        {
+            // Distances are stored in the alpha channel, the field covers the glyph and its margin
+            const std::vector<std::uint8_t> field = computeDistanceField(bitmap, DistanceFieldSpread);
+
+            const unsigned int fieldWidth = bitmap.width + 2 * DistanceFieldSpread;
+            for (unsigned int y = glyphPadding; y < size.y - glyphPadding; ++y)
+            {
+                for (unsigned int x = glyphPadding; x < size.x - glyphPadding; ++x)
+                {
+                    const std::size_t index    = x + y * size.x;
+                    pixelBuffer[index * 4 + 3] = field[(x - glyphPadding) + (y - glyphPadding) * fieldWidth];
+                }
+            }
+        }
+        else if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
         {
             // Pixels are 1 bit monochrome values
             for (unsigned int y = padding; y < size.y - padding; ++y)
@@ -632,7 +1191,7 @@ Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool
                 {
                     // The color channels remain white, just fill the alpha channel
                     const std::size_t index = x + y * size.x;
-                    m_pixelBuffer[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? 255 : 0;
+                    pixelBuffer[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? 255 : 0;
                 }
                 pixels += bitmap.pitch;
             }
@@ -645,139 +1204,261 @@ Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool
                 for (unsigned int x = padding; x < size.x - padding; ++x)
                 {
                     // The color channels remain white, just fill the alpha channel
-                    const std::size_t index      = x + y * size.x;
-                    m_pixelBuffer[index * 4 + 3] = pixels[x - padding];
+                    const std::size_t index    = x + y * size.x;
+                    pixelBuffer[index * 4 + 3] = pixels[x - padding];
                 }
                 pixels += bitmap.pitch;
             }
         }
 
-        // Write the pixels to the texture
-        const auto dest       = Vector2u(glyph.textureRect.position) - Vector2u(padding, padding);
-        const auto updateSize = Vector2u(glyph.textureRect.size) + 2u * Vector2u(padding, padding);
-        page.texture.update(m_pixelBuffer.data(), updateSize, dest);
+        output.size = size;
     }
 
     // Delete the FT glyph
     FT_Done_Glyph(glyphDesc);
-
-    // Done :)
-    return glyph;
 }
 
 
 ////////////////////////////////////////////////////////////
-IntRect Font::findGlyphRect(Page& page, Vector2u size) const
+Glyph Font::storeGlyph(const RasterizedGlyph& rasterizedGlyph, unsigned int characterSize) const
 {
-    // Find the line that fits well the glyph
-    Row*  row       = nullptr;
-    float bestRatio = 0;
-    for (auto it = page.rows.begin(); it != page.rows.end() && !row; ++it)
+    Glyph glyph = rasterizedGlyph.glyph;
+
+    const Vector2u size = rasterizedGlyph.size;
+    if ((size.x > 0) && (size.y > 0))
     {
-        const float ratio = static_cast<float>(size.y) / static_cast<float>(it->height);
+        const unsigned int padding = getGlyphPadding();
 
-        // Ignore rows that are either too small or too high
-        if ((ratio < 0.7f) || (ratio > 1.f))
-            continue;
+        // Get the glyphs page corresponding to the character size
+        Page& page = loadPage(characterSize);
 
-        // Check if there's enough horizontal space left in the row
-        if (size.x > page.texture.getSize().x - it->width)
-            continue;
+        // Find a good position for the new glyph into the texture
+        glyph.textureRect = findGlyphRect(page, size);
 
-        // Make sure that this new row is the best found so far
-        if (ratio < bestRatio)
-            continue;
+        // Make sure the texture data is positioned in the center
+        // of the allocated texture rectangle
+        glyph.textureRect.position += Vector2i(Vector2u(padding, padding));
+        glyph.textureRect.size -= 2 * Vector2i(Vector2u(padding, padding));
 
-        // The current row passed all the tests: we can select it
-        row       = &*it;
-        bestRatio = ratio;
+        // Write the pixels to the copy of the texture if there is one, the caller uploads them
+        const auto dest = Vector2u(glyph.textureRect.position) - Vector2u(padding, padding);
+        if (page.pixels.empty())
+        {
+            page.texture.update(rasterizedGlyph.pixels.data(), size, dest);
+        }
+        else
+        {
+            copyPixels(rasterizedGlyph.pixels.data(),
+                       size.x,
+                       {},
+                       page.pixels.data(),
+                       page.texture.getSize().x,
+                       dest,
+                       size);
+            page.markDirty({dest, size});
+        }
     }
 
-    // If we didn't find a matching row, create a new one (10% taller than the glyph)
-    if (!row)
+    return glyph;
+}
+
+
+////////////////////////////////////////////////////////////
+IntRect Font::findGlyphRect(Page& page, Vector2u size) const
+{
+    unsigned int maximumSize = m_maximumTextureSize ? std::min(m_maximumTextureSize, Texture::getMaximumSize())
+                                                    : Texture::getMaximumSize();
+    bool         evicted     = false;
+
+    std::optional<Vector2u> position = page.pack(size);
+    while (!position)
     {
-        const unsigned int rowHeight = size.y + size.y / 10;
-        while ((page.nextRow + rowHeight >= page.texture.getSize().y) || (size.x >= page.texture.getSize().x))
+        // Not enough space: resize the texture if possible
+        const Vector2u textureSize = page.texture.getSize();
+        if ((textureSize.x * 2 <= maximumSize) && (textureSize.y * 2 <= maximumSize))
         {
-            // Not enough space: resize the texture if possible
-            const Vector2u textureSize = page.texture.getSize();
-            if ((textureSize.x * 2 <= Texture::getMaximumSize()) && (textureSize.y * 2 <= Texture::getMaximumSize()))
+            // Make the texture 2 times bigger
+            Texture newTexture;
+            if (!newTexture.resize(textureSize * 2u))
             {
-                // Make the texture 2 times bigger
-                Texture newTexture;
-                if (!newTexture.resize(textureSize * 2u))
-                {
-                    err() << "Failed to create new page texture" << std::endl;
-                    return {{0, 0}, {2, 2}};
-                }
+                err() << "Failed to create new page texture" << std::endl;
+                return {{0, 0}, {2, 2}};
+            }
 
-                newTexture.setSmooth(m_isSmooth);
-                newTexture.update(page.texture);
-                page.texture.swap(newTexture);
+            newTexture.setSmooth(m_isSmooth);
+            newTexture.update(page.texture);
+            page.texture.swap(newTexture);
+
+            // Enlarge the copy of the pixels the same way, if there is one
+            if (!page.pixels.empty())
+            {
+                std::vector<std::uint8_t> newPixels(std::size_t{textureSize.x} * textureSize.y * 4 * 4);
+                copyPixels(page.pixels.data(), textureSize.x, {}, newPixels.data(), textureSize.x * 2, {}, textureSize);
+                page.pixels.swap(newPixels);
             }
+
+            // The new columns on the right are free up to the top of the texture
+            page.skyline.push_back({textureSize.x, 0, textureSize.x});
+            ++page.regrowths;
+        }
+        else if (!evicted)
+        {
+            // Make room by forgetting the glyphs that haven't been used for the longest time, unless other threads
+            // have batched draws that expect the glyphs where they are: the texture grows past its maximum size then
+            evicted = true;
+            if (page.texture.invalidateLayout())
+                evictGlyphs(page);
             else
+                maximumSize = Texture::getMaximumSize();
+        }
+        else
+        {
+            // Oops, we've reached the maximum texture size...
+            err() << "Failed to add a new character to the font: the maximum texture size has been reached"
+                  << std::endl;
+            return {{0, 0}, {2, 2}};
+        }
+
+        position = page.pack(size);
+    }
+
+    return IntRect(Rect<unsigned int>(*position, size));
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::evictGlyphs(Page& page) const
+{
+    // Scaled distance field glyphs are derived again from the reference size when requested
+    if (m_isDistanceField)
+    {
+        for (auto& [size, table] : page.glyphs)
+        {
+            if (size != DistanceFieldCharacterSize)
             {
-                // Oops, we've reached the maximum texture size...
-                err() << "Failed to add a new character to the font: the maximum texture size has been reached"
-                      << std::endl;
-                return {{0, 0}, {2, 2}};
+                for (auto& [key, cachedGlyph] : table)
+                    cachedGlyph.evicted = true;
             }
         }
+    }
 
-        // We can now create the new row
-        page.rows.emplace_back(page.nextRow, rowHeight);
-        page.nextRow += rowHeight;
-        row = &page.rows.back();
+    // Gather the glyphs that occupy space in the texture, most recently used first
+    // (of all character sizes when the page is shared)
+    std::vector<CachedGlyph*> glyphs;
+    for (auto& [size, table] : page.glyphs)
+    {
+        for (auto& [key, cachedGlyph] : table)
+        {
+            if (!cachedGlyph.evicted && (cachedGlyph.glyph.textureRect.size.x > 0))
+                glyphs.push_back(&cachedGlyph);
+        }
     }
 
-    // Find the glyph's rectangle on the selected row
-    IntRect rect(Rect<unsigned int>({row->width, row->top}, size));
+    if (glyphs.empty())
+        return;
 
-    // Update the row information
-    row->width += size.x;
+    std::sort(glyphs.begin(),
+              glyphs.end(),
+              [](const CachedGlyph* left, const CachedGlyph* right) { return left->lastUse > right->lastUse; });
 
-    return rect;
-}
+    // Keep the most recently used glyphs until they cover half of the texture,
+    // so that evictions don't need to happen again on the next new glyph;
+    // the pinned glyphs are the most recently used ones, they are all kept
+    const Vector2u      textureSize = page.texture.getSize();
+    const std::uint64_t budget      = std::uint64_t{textureSize.x} * std::uint64_t{textureSize.y} / 2;
 
+    // The glyphs are moved within a new copy of the pixels, since their new places can overlap the old ones;
+    // the texture is only read back on the first eviction, then the area of the moved glyphs is uploaded again
+    page.loadPixels();
+    page.keepPixels = true;
+    std::vector<std::uint8_t> pixels(page.pixels.size());
 
-////////////////////////////////////////////////////////////
-bool Font::setCurrentSize(unsigned int characterSize) const
-{
-    // FT_Set_Pixel_Sizes is an expensive function, so we must call it
-    // only when necessary to avoid killing performances
+    // Restore the 2x2 white square for texturing underlines
+    copyPixels(page.pixels.data(), textureSize.x, {}, pixels.data(), textureSize.x, {}, {2, 2});
 
-    // m_fontHandles and m_fontHandles->face are checked to be non-null before calling this method
-    FT_Face         face        = m_fontHandles->face;
-    const FT_UShort currentSize = face->size->metrics.x_ppem;
+    page.resetPacking();
 
-    if (currentSize != characterSize)
+    const auto padding = Vector2i(Vector2u(getGlyphPadding(), getGlyphPadding()));
+    for (CachedGlyph* cachedGlyph : glyphs)
     {
-        const FT_Error result = FT_Set_Pixel_Sizes(face, 0, characterSize);
+        IntRect& textureRect = cachedGlyph->glyph.textureRect;
 
-        if (result == FT_Err_Invalid_Pixel_Size)
+        // Include the padding, so that filtering doesn't pick pixels of other glyphs
+        const IntRect  paddedRect(textureRect.position - padding, textureRect.size + 2 * padding);
+        const Vector2u paddedSize(paddedRect.size);
+
+        const bool pinned = (page.pinnedUse > 0) && (cachedGlyph->lastUse >= page.pinnedUse);
+
+        std::optional<Vector2u> position;
+        if (pinned || (page.packedArea + std::uint64_t{paddedSize.x} * std::uint64_t{paddedSize.y} <= budget))
+            position = page.pack(paddedSize);
+
+        if (position)
         {
-            // In the case of bitmap fonts, resizing can
-            // fail if the requested size is not available
-            if (!FT_IS_SCALABLE(face))
-            {
-                err() << "Failed to set bitmap font size to " << characterSize << '\n' << "Available sizes are: ";
-                for (int i = 0; i < face->num_fixed_sizes; ++i)
-                {
-                    const long size = (face->available_sizes[i].y_ppem + 32) >> 6;
-                    err() << size << " ";
-                }
-                err() << std::endl;
-            }
-            else
-            {
-                err() << "Failed to set font size to " << characterSize << std::endl;
-            }
+            copyPixels(page.pixels.data(),
+                       textureSize.x,
+                       Vector2u(paddedRect.position),
+                       pixels.data(),
+                       textureSize.x,
+                       *position,
+                       paddedSize);
+
+            // Glyphs packed back at their old place are already in the texture
+            if (*position != Vector2u(paddedRect.position))
+                page.markDirty({*position, paddedSize});
+
+            textureRect.position = Vector2i(*position) + padding;
+        }
+        else if (pinned)
+        {
+            // Pinned glyphs can't be loaded again, or the text that uses them would evict them again and again:
+            // point to the white square like glyphs that don't fit in the texture
+            err() << "Failed to keep a glyph in the font texture: the maximum texture size has been reached"
+                  << std::endl;
+            textureRect = IntRect({0, 0}, {2, 2});
+        }
+        else
+        {
+            // Keep the entry, so that the references to the glyph stay valid
+            textureRect          = IntRect();
+            cachedGlyph->evicted = true;
+            ++page.evictions;
         }
-
-        return result == FT_Err_Ok;
     }
 
-    return true;
+    // The texts using the texture rebuild their geometry with the new glyph positions,
+    // since its layout identifier was changed before the glyphs were moved
+    page.pixels.swap(pixels);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int Font::getGlyphPadding() const
+{
+    return m_isDistanceField ? glyphPadding + DistanceFieldSpread : glyphPadding;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::pinGlyphs(unsigned int characterSize) const
+{
+    Page& page     = loadPage(characterSize);
+    page.pinnedUse = page.useCounter + 1;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::unpinGlyphs(unsigned int characterSize) const
+{
+    loadPage(characterSize).pinnedUse = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::setCurrentSize(unsigned int characterSize) const
+{
+    // m_fontHandles and m_fontHandles->face are checked to be non-null before calling this method
+    return setPixelSize(m_fontHandles->face, characterSize);
 }
 
 
@@ -799,6 +1480,135 @@ Font::Page::Page(bool smooth)
     }
 
     texture.setSmooth(smooth);
+
+    resetPacking();
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::Page::markDirty(const Rect<unsigned int>& rect)
+{
+    if ((dirtyRect.size.x == 0) || (dirtyRect.size.y == 0))
+    {
+        dirtyRect = rect;
+        return;
+    }
+
+    const Vector2u topLeft(std::min(dirtyRect.position.x, rect.position.x),
+                           std::min(dirtyRect.position.y, rect.position.y));
+    const Vector2u bottomRight(std::max(dirtyRect.position.x + dirtyRect.size.x, rect.position.x + rect.size.x),
+                               std::max(dirtyRect.position.y + dirtyRect.size.y, rect.position.y + rect.size.y));
+    dirtyRect = Rect<unsigned int>(topLeft, bottomRight - topLeft);
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::Page::uploadPixels()
+{
+    if ((dirtyRect.size.x == 0) || (dirtyRect.size.y == 0))
+        return;
+
+    const unsigned int width  = texture.getSize().x;
+    const std::size_t  offset = (std::size_t{dirtyRect.position.y} * width + dirtyRect.position.x) * 4;
+    texture.update(pixels.data() + offset, dirtyRect.size, dirtyRect.position, width);
+
+    dirtyRect = {};
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::Page::loadPixels()
+{
+    if (!pixels.empty())
+        return;
+
+    // Without a copy every glyph was uploaded right away, so the texture is up to date
+    const Image image = texture.copyToImage();
+    pixels.assign(image.getPixelsPtr(), image.getPixelsPtr() + std::size_t{image.getSize().x} * image.getSize().y * 4);
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::Page::resetPacking()
+{
+    // The top rows are left empty for the 2x2 white square used for texturing underlines
+    skyline.assign(1, {0, 3, texture.getSize().x});
+    packedArea = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Vector2u> Font::Page::pack(Vector2u size)
+{
+    const Vector2u textureSize = texture.getSize();
+
+    // Find the node where the rectangle's bottom edge would be the lowest (leftmost on ties)
+    std::size_t  bestNode = skyline.size();
+    unsigned int bestY    = 0;
+    for (std::size_t i = 0; i < skyline.size(); ++i)
+    {
+        // Nodes are sorted from left to right, the next ones won't fit either
+        if (skyline[i].x + size.x > textureSize.x)
+            break;
+
+        // The rectangle rests on the highest segment that it spans
+        unsigned int y       = 0;
+        unsigned int spanned = 0;
+        for (std::size_t j = i; spanned < size.x; ++j)
+        {
+            y = std::max(y, skyline[j].y);
+            spanned += skyline[j].width;
+        }
+
+        if ((y + size.y <= textureSize.y) && ((bestNode == skyline.size()) || (y < bestY)))
+        {
+            bestNode = i;
+            bestY    = y;
+        }
+    }
+
+    if (bestNode == skyline.size())
+        return std::nullopt;
+
+    const Vector2u position(skyline[bestNode].x, bestY);
+    const auto     index = static_cast<std::ptrdiff_t>(bestNode);
+
+    // Raise the skyline over the rectangle, shortening or removing the segments that it covers
+    skyline.insert(skyline.begin() + index, {position.x, position.y + size.y, size.x});
+
+    const unsigned int right = position.x + size.x;
+    while ((bestNode + 1 < skyline.size()) && (skyline[bestNode + 1].x < right))
+    {
+        SkylineNode&       node      = skyline[bestNode + 1];
+        const unsigned int nodeRight = node.x + node.width;
+
+        if (nodeRight > right)
+        {
+            node.x     = right;
+            node.width = nodeRight - right;
+            break;
+        }
+
+        skyline.erase(skyline.begin() + index + 1);
+    }
+
+    // Merge the neighbor segments that are at the same height
+    for (std::size_t i = 0; i + 1 < skyline.size();)
+    {
+        if (skyline[i].y == skyline[i + 1].y)
+        {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i) + 1);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    packedArea += std::uint64_t{size.x} * std::uint64_t{size.y};
+
+    return position;
 }
 
 } // namespace sf
@@ -72,6 +72,7 @@ void extensionSanityCheck()
 #else
     check(GLEXT_blend_minmax_dependencies);
     check(GLEXT_multitexture_dependencies);
+    check(GLEXT_texture_compression_dependencies);
     check(GLEXT_blend_func_separate_dependencies);
     check(GLEXT_vertex_buffer_object_dependencies);
     check(GLEXT_shader_objects_dependencies);
@@ -79,7 +80,11 @@ void extensionSanityCheck()
     check(GLEXT_framebuffer_object_dependencies);
     check(GLEXT_framebuffer_blit_dependencies);
     check(GLEXT_framebuffer_multisample_dependencies);
+    check(GLEXT_map_buffer_range_dependencies);
     check(GLEXT_copy_buffer_dependencies);
+    check(GLEXT_uniform_buffer_object_dependencies);
+    check(GLEXT_sync_dependencies);
+    check(GLEXT_get_program_binary_dependencies);
 #endif
 }
 } // namespace
@@ -58,6 +58,10 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 #define GLEXT_multitexture_dependencies ::sf::priv::SF_GL_OES_multitexture, glClientActiveTexture, glActiveTexture
 
+// Core since 1.0
+#define GLEXT_texture_compression    true
+#define GLEXT_glCompressedTexImage2D glCompressedTexImage2D
+
 // Core since 1.0
 #define GLEXT_texture_edge_clamp true
 #define GLEXT_GL_CLAMP           GL_CLAMP_TO_EDGE
@@ -65,20 +69,29 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 // Core since 1.1
 // 1.1 does not support GL_STREAM_DRAW so we just define it to GL_DYNAMIC_DRAW
-#define GLEXT_vertex_buffer_object ::sf::priv::SF_GL_OES_vertex_buffer_object
-#define GLEXT_glBindBuffer         glBindBuffer
-#define GLEXT_glBufferData         glBufferData
-#define GLEXT_glBufferSubData      glBufferSubData
-#define GLEXT_glDeleteBuffers      glDeleteBuffers
-#define GLEXT_glGenBuffers         glGenBuffers
-#define GLEXT_GL_ARRAY_BUFFER      GL_ARRAY_BUFFER
-#define GLEXT_GL_DYNAMIC_DRAW      GL_DYNAMIC_DRAW
-#define GLEXT_GL_STATIC_DRAW       GL_STATIC_DRAW
-#define GLEXT_GL_STREAM_DRAW       GL_DYNAMIC_DRAW
+#define GLEXT_vertex_buffer_object    ::sf::priv::SF_GL_OES_vertex_buffer_object
+#define GLEXT_glBindBuffer            glBindBuffer
+#define GLEXT_glBufferData            glBufferData
+#define GLEXT_glBufferSubData         glBufferSubData
+#define GLEXT_glDeleteBuffers         glDeleteBuffers
+#define GLEXT_glGenBuffers            glGenBuffers
+#define GLEXT_GL_ARRAY_BUFFER         GL_ARRAY_BUFFER
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER GL_ELEMENT_ARRAY_BUFFER
+#define GLEXT_GL_DYNAMIC_DRAW         GL_DYNAMIC_DRAW
+#define GLEXT_GL_STATIC_DRAW          GL_STATIC_DRAW
+#define GLEXT_GL_STREAM_DRAW          GL_DYNAMIC_DRAW
 
 #define GLEXT_vertex_buffer_object_dependencies \
     ::sf::priv::SF_GL_OES_vertex_buffer_object, glBindBuffer, glBufferData, glBufferSubData, glDeleteBuffers, glGenBuffers
 
+// Core since 3.0 - OES_element_index_uint
+// 32-bit indices are not available on OpenGL ES 1
+#define GLEXT_element_index_uint false
+
+// Core since 3.0
+// Uniform buffers are not available on OpenGL ES 1
+#define GLEXT_uniform_buffer_object false
+
 // The following extensions are listed chronologically
 // Extension macro first, followed by tokens then
 // functions according to the corresponding specification
@@ -180,6 +193,10 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 #define GLEXT_EXT_blend_minmax_dependencies SF_GLAD_GL_EXT_blend_minmax, glBlendEquationEXT
 
+// Core since 3.0 - EXT_unpack_subimage
+#define GLEXT_unpack_subimage      false
+#define GLEXT_GL_UNPACK_ROW_LENGTH 0
+
 #else
 
 // SFML requires at a bare minimum OpenGL 1.1 capability
@@ -187,8 +204,11 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 // and has to be checked for prior to use
 
 // Core since 1.1
-#define GLEXT_GL_DEPTH_COMPONENT GL_DEPTH_COMPONENT
-#define GLEXT_GL_CLAMP           GL_CLAMP
+#define GLEXT_GL_DEPTH_COMPONENT   GL_DEPTH_COMPONENT
+#define GLEXT_GL_CLAMP             GL_CLAMP
+#define GLEXT_element_index_uint   true
+#define GLEXT_unpack_subimage      true
+#define GLEXT_GL_UNPACK_ROW_LENGTH GL_UNPACK_ROW_LENGTH
 
 // The following extensions are listed chronologically
 // Extension macro first, followed by tokens then
@@ -222,6 +242,12 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 #define GLEXT_multitexture_dependencies SF_GLAD_GL_ARB_multitexture, glClientActiveTextureARB, glActiveTextureARB
 
+// Core since 1.3 - ARB_texture_compression
+#define GLEXT_texture_compression       SF_GLAD_GL_VERSION_1_3
+#define GLEXT_glCompressedTexImage2D    glCompressedTexImage2D
+
+#define GLEXT_texture_compression_dependencies SF_GLAD_GL_VERSION_1_3, glCompressedTexImage2D
+
 // Core since 1.4 - EXT_blend_func_separate
 #define GLEXT_blend_func_separate       SF_GLAD_GL_EXT_blend_func_separate
 #define GLEXT_glBlendFuncSeparate       glBlendFuncSeparateEXT
@@ -231,6 +257,7 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 // Core since 1.5 - ARB_vertex_buffer_object
 #define GLEXT_vertex_buffer_object             SF_GLAD_GL_ARB_vertex_buffer_object
 #define GLEXT_GL_ARRAY_BUFFER                  GL_ARRAY_BUFFER_ARB
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER          GL_ELEMENT_ARRAY_BUFFER_ARB
 #define GLEXT_GL_DYNAMIC_DRAW                  GL_DYNAMIC_DRAW_ARB
 #define GLEXT_GL_READ_ONLY                     GL_READ_ONLY_ARB
 #define GLEXT_GL_STATIC_DRAW                   GL_STATIC_DRAW_ARB
@@ -314,6 +341,11 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_texture_sRGB                         SF_GLAD_GL_EXT_texture_sRGB
 #define GLEXT_GL_SRGB8_ALPHA8                      GL_SRGB8_ALPHA8_EXT
 
+// Core since 2.1 - ARB_pixel_buffer_object, uses the entry points of ARB_vertex_buffer_object
+#define GLEXT_pixel_buffer_object  (GLEXT_vertex_buffer_object && GLEXT_GL_VERSION_2_1)
+#define GLEXT_GL_PIXEL_PACK_BUFFER GL_PIXEL_PACK_BUFFER
+#define GLEXT_GL_STREAM_READ       GL_STREAM_READ_ARB
+
 // Core since 3.0 - EXT_framebuffer_object
 #define GLEXT_framebuffer_object                   SF_GLAD_GL_EXT_framebuffer_object
 #define GLEXT_glBindRenderbuffer                   glBindRenderbufferEXT
@@ -364,6 +396,16 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_framebuffer_multisample_dependencies \
     SF_GLAD_GL_EXT_framebuffer_multisample, glRenderbufferStorageMultisampleEXT
 
+// Core since 3.0 - ARB_map_buffer_range
+#define GLEXT_map_buffer_range             SF_GLAD_GL_ARB_map_buffer_range
+#define GLEXT_GL_MAP_WRITE_BIT             GL_MAP_WRITE_BIT
+#define GLEXT_GL_MAP_INVALIDATE_RANGE_BIT  GL_MAP_INVALIDATE_RANGE_BIT
+#define GLEXT_GL_MAP_INVALIDATE_BUFFER_BIT GL_MAP_INVALIDATE_BUFFER_BIT
+#define GLEXT_GL_MAP_UNSYNCHRONIZED_BIT    GL_MAP_UNSYNCHRONIZED_BIT
+#define GLEXT_glMapBufferRange             glMapBufferRange
+
+#define GLEXT_map_buffer_range_dependencies SF_GLAD_GL_ARB_map_buffer_range, glMapBufferRange
+
 // Core since 3.1 - ARB_copy_buffer
 #define GLEXT_copy_buffer          SF_GLAD_GL_ARB_copy_buffer
 #define GLEXT_GL_COPY_READ_BUFFER  GL_COPY_READ_BUFFER
@@ -372,12 +414,72 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 #define GLEXT_copy_buffer_dependencies SF_GLAD_GL_ARB_copy_buffer, glCopyBufferSubData
 
+// Core since 3.1 - ARB_uniform_buffer_object
+#define GLEXT_uniform_buffer_object          SF_GLAD_GL_ARB_uniform_buffer_object
+#define GLEXT_glGetUniformBlockIndex         glGetUniformBlockIndex
+#define GLEXT_glUniformBlockBinding          glUniformBlockBinding
+#define GLEXT_glBindBufferBase               glBindBufferBase
+#define GLEXT_GL_UNIFORM_BUFFER              GL_UNIFORM_BUFFER
+#define GLEXT_GL_MAX_UNIFORM_BUFFER_BINDINGS GL_MAX_UNIFORM_BUFFER_BINDINGS
+#define GLEXT_GL_INVALID_INDEX               GL_INVALID_INDEX
+
+#define GLEXT_uniform_buffer_object_dependencies \
+    SF_GLAD_GL_ARB_uniform_buffer_object, glGetUniformBlockIndex, glUniformBlockBinding, glBindBufferBase
+
 // Core since 3.2 - ARB_geometry_shader4
 #define GLEXT_geometry_shader4         SF_GLAD_GL_ARB_geometry_shader4
 #define GLEXT_GL_GEOMETRY_SHADER       GL_GEOMETRY_SHADER_ARB
 
+// Core since 3.2 - ARB_sync
+#define GLEXT_sync                          SF_GLAD_GL_ARB_sync
+#define GLEXT_GLsync                        GLsync
+#define GLEXT_glFenceSync                   glFenceSync
+#define GLEXT_glClientWaitSync              glClientWaitSync
+#define GLEXT_glDeleteSync                  glDeleteSync
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT    GL_SYNC_FLUSH_COMMANDS_BIT
+#define GLEXT_GL_TIMEOUT_EXPIRED            GL_TIMEOUT_EXPIRED
+#define GLEXT_GL_WAIT_FAILED                GL_WAIT_FAILED
+
+#define GLEXT_sync_dependencies SF_GLAD_GL_ARB_sync, glFenceSync, glClientWaitSync, glDeleteSync
+
+// Core since 4.1 - ARB_get_program_binary
+#define GLEXT_get_program_binary                 SF_GLAD_GL_ARB_get_program_binary
+#define GLEXT_glGetProgramBinary                 glGetProgramBinary
+#define GLEXT_glProgramBinary                    glProgramBinary
+#define GLEXT_glProgramParameteri                glProgramParameteri
+#define GLEXT_glGetProgramiv                     glGetProgramiv
+#define GLEXT_GL_PROGRAM_BINARY_LENGTH           GL_PROGRAM_BINARY_LENGTH
+#define GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS      GL_NUM_PROGRAM_BINARY_FORMATS
+
+#define GLEXT_get_program_binary_dependencies \
+    SF_GLAD_GL_ARB_get_program_binary, glGetProgramBinary, glProgramBinary, glProgramParameteri, glGetProgramiv
+
 #endif
 
+// Compressed texture formats
+// Their support depends on the driver and is queried through GL_COMPRESSED_TEXTURE_FORMATS
+// EXT_texture_compression_s3tc only defines tokens, it is not part of the loader
+#define GLEXT_GL_NUM_COMPRESSED_TEXTURE_FORMATS     GL_NUM_COMPRESSED_TEXTURE_FORMATS
+#define GLEXT_GL_COMPRESSED_TEXTURE_FORMATS         GL_COMPRESSED_TEXTURE_FORMATS
+#define GLEXT_GL_COMPRESSED_RGB_S3TC_DXT1           0x83F0
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT1          0x83F1
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT3          0x83F2
+#define GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT5          0x83F3
+#define GLEXT_GL_COMPRESSED_SRGB_S3TC_DXT1          GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1    GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3    GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5    GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT
+#define GLEXT_GL_COMPRESSED_RGBA_BPTC_UNORM         GL_COMPRESSED_RGBA_BPTC_UNORM
+#define GLEXT_GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM   GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM
+#define GLEXT_GL_COMPRESSED_RGB8_ETC2               GL_COMPRESSED_RGB8_ETC2
+#define GLEXT_GL_COMPRESSED_SRGB8_ETC2              GL_COMPRESSED_SRGB8_ETC2
+#define GLEXT_GL_COMPRESSED_RGB8_ALPHA1_ETC2        GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2
+#define GLEXT_GL_COMPRESSED_SRGB8_ALPHA1_ETC2       GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2
+#define GLEXT_GL_COMPRESSED_RGBA8_ETC2_EAC          GL_COMPRESSED_RGBA8_ETC2_EAC
+#define GLEXT_GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC   GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC
+
 // OpenGL Versions
 #define GLEXT_GL_VERSION_1_0 SF_GLAD_GL_VERSION_1_0
 #define GLEXT_GL_VERSION_1_1 SF_GLAD_GL_VERSION_1_1
@@ -42,15 +42,29 @@
 #include <stb_image_write.h>
 
 #include <algorithm>
+#include <array>
 #include <iomanip>
 #include <memory>
 #include <ostream>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include <cassert>
+#include <cmath>
 #include <cstring>
 
+// SSE2 and NEON are part of the baseline of x86-64 and ARM64, no runtime detection is needed
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define SFML_IMAGE_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define SFML_IMAGE_NEON
+#endif
+
 
 namespace
 {
@@ -92,11 +106,458 @@ struct StbDeleter
     }
 };
 using StbPtr = std::unique_ptr<stbi_uc, StbDeleter>;
+
+// Allocate an uninitialized buffer for the pixels of an image of the given size
+sf::Image::PixelBuffer allocatePixels(sf::Vector2u size)
+{
+    return sf::Image::PixelBuffer(new std::uint8_t[std::size_t{size.x} * std::size_t{size.y} * 4]);
+}
+
+// Take ownership of a buffer returned by the decoder, so that its pixels don't have to be copied
+sf::Image::PixelBuffer adoptDecodedPixels(StbPtr pixels)
+{
+    return {pixels.release(), StbDeleter()};
+}
+
+// Pack the components of a pixel into a 32-bit value, with the same layout as in memory
+std::uint32_t packPixel(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a)
+{
+    const std::uint8_t components[]{r, g, b, a};
+    std::uint32_t      pixel = 0;
+    std::memcpy(&pixel, components, sizeof(pixel));
+    return pixel;
+}
+
+// Replace the pixels equal to `key` with `replacement`, 4 pixels at a time when possible
+void replacePixels(std::uint8_t* pixels, std::size_t count, std::uint32_t key, std::uint32_t replacement)
+{
+    std::size_t i = 0;
+
+#if defined(SFML_IMAGE_SSE2)
+    const __m128i keys         = _mm_set1_epi32(static_cast<int>(key));
+    const __m128i replacements = _mm_set1_epi32(static_cast<int>(replacement));
+    for (; i + 4 <= count; i += 4)
+    {
+        auto*         block = reinterpret_cast<__m128i*>(pixels + i * 4);
+        const __m128i value = _mm_loadu_si128(block);
+        const __m128i match = _mm_cmpeq_epi32(value, keys);
+        _mm_storeu_si128(block, _mm_or_si128(_mm_and_si128(match, replacements), _mm_andnot_si128(match, value)));
+    }
+#elif defined(SFML_IMAGE_NEON)
+    const uint32x4_t keys         = vdupq_n_u32(key);
+    const uint32x4_t replacements = vdupq_n_u32(replacement);
+    for (; i + 4 <= count; i += 4)
+    {
+        std::uint8_t*    block = pixels + i * 4;
+        const uint32x4_t value = vreinterpretq_u32_u8(vld1q_u8(block));
+        const uint32x4_t match = vceqq_u32(value, keys);
+        vst1q_u8(block, vreinterpretq_u8_u32(vbslq_u32(match, replacements, value)));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        std::uint32_t value = 0;
+        std::memcpy(&value, pixels + i * 4, sizeof(value));
+        if (value == key)
+            std::memcpy(pixels + i * 4, &replacement, sizeof(replacement));
+    }
+}
+
+// Reverse the order of the pixels of a row, swapping blocks of 4 pixels when possible
+void reverseRow(std::uint8_t* row, std::size_t width)
+{
+    std::size_t left  = 0;
+    std::size_t right = width;
+
+#if defined(SFML_IMAGE_SSE2)
+    while (right - left >= 8)
+    {
+        auto*         leftBlock  = reinterpret_cast<__m128i*>(row + left * 4);
+        auto*         rightBlock = reinterpret_cast<__m128i*>(row + (right - 4) * 4);
+        const __m128i leftValue  = _mm_shuffle_epi32(_mm_loadu_si128(leftBlock), _MM_SHUFFLE(0, 1, 2, 3));
+        const __m128i rightValue = _mm_shuffle_epi32(_mm_loadu_si128(rightBlock), _MM_SHUFFLE(0, 1, 2, 3));
+        _mm_storeu_si128(leftBlock, rightValue);
+        _mm_storeu_si128(rightBlock, leftValue);
+        left += 4;
+        right -= 4;
+    }
+#elif defined(SFML_IMAGE_NEON)
+    const auto reverse = [](uint32x4_t value)
+    {
+        value = vrev64q_u32(value);
+        return vextq_u32(value, value, 2);
+    };
+
+    while (right - left >= 8)
+    {
+        std::uint8_t*    leftBlock  = row + left * 4;
+        std::uint8_t*    rightBlock = row + (right - 4) * 4;
+        const uint32x4_t leftValue  = reverse(vreinterpretq_u32_u8(vld1q_u8(leftBlock)));
+        const uint32x4_t rightValue = reverse(vreinterpretq_u32_u8(vld1q_u8(rightBlock)));
+        vst1q_u8(leftBlock, vreinterpretq_u8_u32(rightValue));
+        vst1q_u8(rightBlock, vreinterpretq_u8_u32(leftValue));
+        left += 4;
+        right -= 4;
+    }
+#endif
+
+    while (right - left >= 2)
+    {
+        std::swap_ranges(row + left * 4, row + left * 4 + 4, row + (right - 1) * 4);
+        ++left;
+        --right;
+    }
+}
+
+// Image kept in linear, alpha-premultiplied floating point RGBA while it is being resampled
+struct FloatImage
+{
+    sf::Vector2u       size;
+    std::vector<float> pixels;
+};
+
+// Table converting 8-bit sRGB encoded components to linear light
+const std::array<float, 256>& getSrgbToLinearTable()
+{
+    static const auto table = []
+    {
+        std::array<float, 256> result{};
+        for (std::size_t i = 0; i < result.size(); ++i)
+        {
+            const float value = static_cast<float>(i) / 255.f;
+            result[i] = (value <= 0.04045f) ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+        }
+        return result;
+    }();
+    return table;
+}
+
+// Table converting linear light components, quantized to 12 bits, to 8-bit sRGB
+const std::array<std::uint8_t, 4096>& getLinearToSrgbTable()
+{
+    static const auto table = []
+    {
+        std::array<std::uint8_t, 4096> result{};
+        for (std::size_t i = 0; i < result.size(); ++i)
+        {
+            const float value   = static_cast<float>(i) / 4095.f;
+            const float encoded = (value <= 0.0031308f) ? value * 12.92f
+                                                        : 1.055f * std::pow(value, 1.f / 2.4f) - 0.055f;
+            result[i]           = static_cast<std::uint8_t>(std::clamp(encoded, 0.f, 1.f) * 255.f + 0.5f);
+        }
+        return result;
+    }();
+    return table;
+}
+
+// Convert 8-bit pixels to linear, alpha-premultiplied floating point pixels
+FloatImage toFloatImage(const std::uint8_t* pixels, sf::Vector2u size, bool sRgb)
+{
+    FloatImage  image{size, std::vector<float>(std::size_t{size.x} * std::size_t{size.y} * 4)};
+    const auto& table = getSrgbToLinearTable();
+
+    for (std::size_t i = 0; i < image.pixels.size(); i += 4)
+    {
+        const float alpha = static_cast<float>(pixels[i + 3]) / 255.f;
+        for (std::size_t j = 0; j < 3; ++j)
+        {
+            const float value   = sRgb ? table[pixels[i + j]] : static_cast<float>(pixels[i + j]) / 255.f;
+            image.pixels[i + j] = value * alpha;
+        }
+        image.pixels[i + 3] = alpha;
+    }
+
+    return image;
+}
+
+// Convert linear, alpha-premultiplied floating point pixels back to an 8-bit image
+sf::Image toImage(const FloatImage& image, bool sRgb)
+{
+    sf::Image::PixelBuffer pixels = allocatePixels(image.size);
+    const auto&            table  = getLinearToSrgbTable();
+
+    for (std::size_t i = 0; i < image.pixels.size(); i += 4)
+    {
+        // Filters with negative lobes can overshoot, hence the clamping
+        const float alpha = std::clamp(image.pixels[i + 3], 0.f, 1.f);
+        const float scale = (alpha > 0.f) ? 1.f / alpha : 0.f;
+        for (std::size_t j = 0; j < 3; ++j)
+        {
+            const float value = std::clamp(image.pixels[i + j] * scale, 0.f, 1.f);
+            pixels[i + j]     = sRgb ? table[static_cast<std::size_t>(value * 4095.f + 0.5f)]
+                                     : static_cast<std::uint8_t>(value * 255.f + 0.5f);
+        }
+        pixels[i + 3] = static_cast<std::uint8_t>(alpha * 255.f + 0.5f);
+    }
+
+    return {image.size, std::move(pixels)};
+}
+
+// Evaluate a resampling filter, `x` being the distance to the center in source pixels
+float evaluateFilter(sf::Image::ResampleFilter filter, float x)
+{
+    constexpr float pi = 3.141592654f;
+
+    switch (filter)
+    {
+        case sf::Image::ResampleFilter::Box:
+            return ((x >= -0.5f) && (x < 0.5f)) ? 1.f : 0.f;
+        case sf::Image::ResampleFilter::Bilinear:
+            return std::max(1.f - std::abs(x), 0.f);
+        case sf::Image::ResampleFilter::Lanczos:
+            if (x == 0.f)
+                return 1.f;
+            if (std::abs(x) >= 3.f)
+                return 0.f;
+            return 3.f * std::sin(pi * x) * std::sin(pi * x / 3.f) / (pi * pi * x * x);
+    }
+
+    return 0.f;
+}
+
+// Get the distance to the center beyond which a resampling filter is zero
+float getFilterSupport(sf::Image::ResampleFilter filter)
+{
+    switch (filter)
+    {
+        case sf::Image::ResampleFilter::Box:
+            return 0.5f;
+        case sf::Image::ResampleFilter::Bilinear:
+            return 1.f;
+        case sf::Image::ResampleFilter::Lanczos:
+            return 3.f;
+    }
+
+    return 1.f;
+}
+
+// Source pixels and weights contributing to each destination pixel, along one axis
+struct ResampleWeights
+{
+    std::vector<std::size_t> first;   //!< Index of the first source pixel contributing to each destination pixel
+    std::vector<std::size_t> count;   //!< Number of source pixels contributing to each destination pixel
+    std::vector<float>       weights; //!< Weights of the source pixels, `stride` per destination pixel
+    std::size_t              stride{};
+};
+
+// Compute the weights to resample `sourceSize` pixels to `destinationSize` pixels along one axis
+ResampleWeights computeResampleWeights(unsigned int              sourceSize,
+                                       unsigned int              destinationSize,
+                                       sf::Image::ResampleFilter filter)
+{
+    // When shrinking, the filter is stretched so that every source pixel contributes
+    const float scale       = static_cast<float>(sourceSize) / static_cast<float>(destinationSize);
+    const float filterScale = std::max(scale, 1.f);
+    const float support     = getFilterSupport(filter) * filterScale;
+
+    ResampleWeights result;
+    result.stride = static_cast<std::size_t>(2.f * support) + 2;
+    result.first.resize(destinationSize);
+    result.count.resize(destinationSize);
+    result.weights.resize(std::size_t{destinationSize} * result.stride);
+
+    const auto lastSource = static_cast<long long>(sourceSize) - 1;
+
+    for (std::size_t i = 0; i < destinationSize; ++i)
+    {
+        const float     center  = (static_cast<float>(i) + 0.5f) * scale - 0.5f;
+        const auto      left    = static_cast<long long>(std::ceil(center - support));
+        const auto      right   = static_cast<long long>(std::floor(center + support));
+        const long long first   = std::clamp(left, 0LL, lastSource);
+        const long long last    = std::clamp(right, 0LL, lastSource);
+        float*          weights = &result.weights[i * result.stride];
+
+        // Taps outside of the image are clamped to its edges
+        float sum = 0.f;
+        for (long long j = left; j <= right; ++j)
+        {
+            const float weight = evaluateFilter(filter, (static_cast<float>(j) - center) / filterScale);
+            weights[std::clamp(j, first, last) - first] += weight;
+            sum += weight;
+        }
+
+        result.first[i] = static_cast<std::size_t>(first);
+        result.count[i] = static_cast<std::size_t>(last - first + 1);
+
+        if (sum != 0.f)
+        {
+            for (std::size_t j = 0; j < result.count[i]; ++j)
+                weights[j] /= sum;
+        }
+        else
+        {
+            // Degenerate case, fall back to the nearest source pixel
+            std::fill(weights, weights + result.stride, 0.f);
+            result.first[i] = static_cast<std::size_t>(std::clamp(std::llround(center), 0LL, lastSource));
+            result.count[i] = 1;
+            weights[0]      = 1.f;
+        }
+    }
+
+    return result;
+}
+
+// Sum `count` RGBA pixels spaced by `step` floats, each multiplied by its weight
+void convolvePixel(const float* source, std::size_t step, const float* weights, std::size_t count, float* destination)
+{
+#if defined(SFML_IMAGE_SSE2)
+    __m128 sum = _mm_setzero_ps();
+    for (std::size_t i = 0; i < count; ++i)
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(source + i * step), _mm_set1_ps(weights[i])));
+    _mm_storeu_ps(destination, sum);
+#elif defined(SFML_IMAGE_NEON)
+    float32x4_t sum = vdupq_n_f32(0.f);
+    for (std::size_t i = 0; i < count; ++i)
+        sum = vmlaq_n_f32(sum, vld1q_f32(source + i * step), weights[i]);
+    vst1q_f32(destination, sum);
+#else
+    float sum[4]{};
+    for (std::size_t i = 0; i < count; ++i)
+        for (std::size_t j = 0; j < 4; ++j)
+            sum[j] += source[i * step + j] * weights[i];
+    std::memcpy(destination, sum, sizeof(sum));
+#endif
+}
+
+// Add a row of `count` floats multiplied by `weight` to another row
+void accumulateRow(const float* source, float weight, std::size_t count, float* destination)
+{
+    std::size_t i = 0;
+
+#if defined(SFML_IMAGE_SSE2)
+    const __m128 weights = _mm_set1_ps(weight);
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(destination + i,
+                      _mm_add_ps(_mm_loadu_ps(destination + i), _mm_mul_ps(_mm_loadu_ps(source + i), weights)));
+#elif defined(SFML_IMAGE_NEON)
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(destination + i, vmlaq_n_f32(vld1q_f32(destination + i), vld1q_f32(source + i), weight));
+#endif
+
+    for (; i < count; ++i)
+        destination[i] += source[i] * weight;
+}
+
+// Split [0, count) into contiguous ranges processed by up to `threadCount` threads, the calling thread included
+template <typename Function>
+void parallelFor(std::size_t count, unsigned int threadCount, const Function& function)
+{
+    if (threadCount == 0)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    const std::size_t chunkCount = std::min(std::size_t{threadCount}, count);
+    if (chunkCount <= 1)
+    {
+        function(std::size_t{0}, count);
+        return;
+    }
+
+    const std::size_t        chunkSize = (count + chunkCount - 1) / chunkCount;
+    std::vector<std::thread> threads;
+    threads.reserve(chunkCount - 1);
+
+    for (std::size_t begin = chunkSize; begin < count; begin += chunkSize)
+    {
+        const std::size_t end = std::min(begin + chunkSize, count);
+        try
+        {
+            threads.emplace_back([&function, begin, end] { function(begin, end); });
+        }
+        catch (const std::system_error&)
+        {
+            // The system refused to create a thread, process the range here instead
+            function(begin, end);
+        }
+    }
+
+    function(std::size_t{0}, chunkSize);
+
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+// Resample an image with a separable filter: rows first, then columns
+FloatImage resamplePixels(const FloatImage&        source,
+                          sf::Vector2u             size,
+                          sf::Image::ResampleFilter filter,
+                          unsigned int             threadCount)
+{
+    const ResampleWeights horizontal = computeResampleWeights(source.size.x, size.x, filter);
+    const ResampleWeights vertical   = computeResampleWeights(source.size.y, size.y, filter);
+
+    const std::size_t sourceRowSize = std::size_t{source.size.x} * 4;
+    const std::size_t rowSize       = std::size_t{size.x} * 4;
+
+    FloatImage rows{{size.x, source.size.y}, std::vector<float>(rowSize * source.size.y)};
+    parallelFor(source.size.y,
+                threadCount,
+                [&](std::size_t begin, std::size_t end)
+                {
+                    for (std::size_t y = begin; y < end; ++y)
+                    {
+                        const float* sourceRow = source.pixels.data() + y * sourceRowSize;
+                        float*       row       = rows.pixels.data() + y * rowSize;
+                        for (std::size_t x = 0; x < size.x; ++x)
+                            convolvePixel(sourceRow + horizontal.first[x] * 4,
+                                          4,
+                                          horizontal.weights.data() + x * horizontal.stride,
+                                          horizontal.count[x],
+                                          row + x * 4);
+                    }
+                });
+
+    // Columns are filtered a whole row at a time, which keeps memory accesses sequential
+    FloatImage result{size, std::vector<float>(rowSize * size.y)};
+    parallelFor(size.y,
+                threadCount,
+                [&](std::size_t begin, std::size_t end)
+                {
+                    for (std::size_t y = begin; y < end; ++y)
+                    {
+                        const float* weights = vertical.weights.data() + y * vertical.stride;
+                        for (std::size_t i = 0; i < vertical.count[y]; ++i)
+                            accumulateRow(rows.pixels.data() + (vertical.first[y] + i) * rowSize,
+                                          weights[i],
+                                          rowSize,
+                                          result.pixels.data() + y * rowSize);
+                    }
+                });
+
+    return result;
+}
 } // namespace
 
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+void Image::PixelDeleter::operator()(std::uint8_t* pixels) const
+{
+    if (m_function)
+        m_function(pixels);
+    else
+        delete[] pixels;
+}
+
+
+////////////////////////////////////////////////////////////
+Image::Image(const Image& copy)
+{
+    resize(copy.m_size, copy.m_pixels.get());
+}
+
+
+////////////////////////////////////////////////////////////
+Image& Image::operator=(const Image& right)
+{
+    if (this != &right)
+        resize(right.m_size, right.m_pixels.get());
+
+    return *this;
+}
+
+
 ////////////////////////////////////////////////////////////
 Image::Image(Vector2u size, Color color)
 {
@@ -111,6 +572,13 @@ Image::Image(Vector2u size, const std::uint8_t* pixels)
 }
 
 
+////////////////////////////////////////////////////////////
+Image::Image(Vector2u size, PixelBuffer pixels)
+{
+    resize(size, std::move(pixels));
+}
+
+
 ////////////////////////////////////////////////////////////
 Image::Image(const std::filesystem::path& filename)
 {
@@ -140,12 +608,13 @@ void Image::resize(Vector2u size, Color color)
 {
     if (size.x && size.y)
     {
-        // Create a new pixel buffer first for exception safety's sake
-        std::vector<std::uint8_t> newPixels(std::size_t{size.x} * std::size_t{size.y} * 4);
+        // Reuse the current pixel buffer if it has the right size, otherwise
+        // create a new one first for exception safety's sake
+        PixelBuffer newPixels = (m_pixels && (size == m_size)) ? std::move(m_pixels) : allocatePixels(size);
 
         // Fill it with the specified color
-        std::uint8_t* ptr = newPixels.data();
-        std::uint8_t* end = ptr + newPixels.size();
+        std::uint8_t* ptr = newPixels.get();
+        std::uint8_t* end = ptr + std::size_t{size.x} * std::size_t{size.y} * 4;
         while (ptr != end)
         {
             *ptr++ = color.r;
@@ -163,7 +632,7 @@ void Image::resize(Vector2u size, Color color)
     else
     {
         // Dump the pixel buffer
-        std::vector<std::uint8_t>().swap(m_pixels);
+        m_pixels.reset();
 
         // Assign the new size
         m_size = {};
@@ -176,8 +645,16 @@ void Image::resize(Vector2u size, const std::uint8_t* pixels)
 {
     if (pixels && size.x && size.y)
     {
-        // Create a new pixel buffer first for exception safety's sake
-        std::vector<std::uint8_t> newPixels(pixels, pixels + size.x * size.y * 4);
+        // Nothing to copy if the pixels are already ours
+        if (pixels == m_pixels.get() && (size == m_size))
+            return;
+
+        // Reuse the current pixel buffer if it has the right size, otherwise
+        // create a new one first for exception safety's sake
+        PixelBuffer newPixels = (m_pixels && (size == m_size)) ? std::move(m_pixels) : allocatePixels(size);
+
+        // The source may point inside the reused buffer, so it may overlap the destination
+        std::memmove(newPixels.get(), pixels, std::size_t{size.x} * std::size_t{size.y} * 4);
 
         // Commit the new pixel buffer
         m_pixels = std::move(newPixels);
@@ -188,7 +665,7 @@ void Image::resize(Vector2u size, const std::uint8_t* pixels)
     else
     {
         // Dump the pixel buffer
-        std::vector<std::uint8_t>().swap(m_pixels);
+        m_pixels.reset();
 
         // Assign the new size
         m_size = {};
@@ -196,6 +673,32 @@ void Image::resize(Vector2u size, const std::uint8_t* pixels)
 }
 
 
+////////////////////////////////////////////////////////////
+void Image::resize(Vector2u size, PixelBuffer pixels)
+{
+    if (pixels && size.x && size.y)
+    {
+        // Adopt the pixel buffer as is, without copying it
+        m_pixels = std::move(pixels);
+        m_size   = size;
+    }
+    else
+    {
+        // Dump the pixel buffer
+        m_pixels.reset();
+        m_size = {};
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+Image::PixelBuffer Image::releasePixels()
+{
+    m_size = {};
+    return std::move(m_pixels);
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Image::loadFromFile(const std::filesystem::path& filename)
 {
@@ -209,20 +712,17 @@ bool Image::loadFromFile(const std::filesystem::path& filename)
 
 #endif
 
-    // Clear the array (just in case)
-    m_pixels.clear();
-
     // Load the image and get a pointer to the pixels in memory
     int width    = 0;
     int height   = 0;
     int channels = 0;
-    if (const auto ptr = StbPtr(stbi_load(filename.string().c_str(), &width, &height, &channels, STBI_rgb_alpha)))
+    if (auto ptr = StbPtr(stbi_load(filename.string().c_str(), &width, &height, &channels, STBI_rgb_alpha)))
     {
         // Assign the image properties
         m_size = Vector2u(Vector2i(width, height));
 
-        // Copy the loaded pixels to the pixel buffer
-        m_pixels.assign(ptr.get(), ptr.get() + width * height * 4);
+        // Keep the decoded pixels without copying them
+        m_pixels = adoptDecodedPixels(std::move(ptr));
 
         return true;
     }
@@ -241,22 +741,19 @@ bool Image::loadFromMemory(const void* data, std::size_t size)
     // Check input parameters
     if (data && size)
     {
-        // Clear the array (just in case)
-        m_pixels.clear();
-
         // Load the image and get a pointer to the pixels in memory
         int         width    = 0;
         int         height   = 0;
         int         channels = 0;
         const auto* buffer   = static_cast<const unsigned char*>(data);
-        if (const auto ptr = StbPtr(
+        if (auto ptr = StbPtr(
                 stbi_load_from_memory(buffer, static_cast<int>(size), &width, &height, &channels, STBI_rgb_alpha)))
         {
             // Assign the image properties
             m_size = Vector2u(Vector2i(width, height));
 
-            // Copy the loaded pixels to the pixel buffer
-            m_pixels.assign(ptr.get(), ptr.get() + width * height * 4);
+            // Keep the decoded pixels without copying them
+            m_pixels = adoptDecodedPixels(std::move(ptr));
 
             return true;
         }
@@ -275,9 +772,6 @@ bool Image::loadFromMemory(const void* data, std::size_t size)
 ////////////////////////////////////////////////////////////
 bool Image::loadFromStream(InputStream& stream)
 {
-    // Clear the array (just in case)
-    m_pixels.clear();
-
     // Make sure that the stream's reading position is at the beginning
     if (!stream.seek(0).has_value())
     {
@@ -295,13 +789,13 @@ bool Image::loadFromStream(InputStream& stream)
     int width    = 0;
     int height   = 0;
     int channels = 0;
-    if (const auto ptr = StbPtr(stbi_load_from_callbacks(&callbacks, &stream, &width, &height, &channels, STBI_rgb_alpha)))
+    if (auto ptr = StbPtr(stbi_load_from_callbacks(&callbacks, &stream, &width, &height, &channels, STBI_rgb_alpha)))
     {
         // Assign the image properties
         m_size = Vector2u(Vector2i(width, height));
 
-        // Copy the loaded pixels to the pixel buffer
-        m_pixels.assign(ptr.get(), ptr.get() + width * height * 4);
+        // Keep the decoded pixels without copying them
+        m_pixels = adoptDecodedPixels(std::move(ptr));
 
         return true;
     }
@@ -316,7 +810,7 @@ bool Image::loadFromStream(InputStream& stream)
 bool Image::saveToFile(const std::filesystem::path& filename) const
 {
     // Make sure the image is not empty
-    if (!m_pixels.empty() && m_size.x > 0 && m_size.y > 0)
+    if (m_pixels && m_size.x > 0 && m_size.y > 0)
     {
         // Deduce the image type from its extension
 
@@ -327,25 +821,25 @@ bool Image::saveToFile(const std::filesystem::path& filename) const
         if (extension == ".bmp")
         {
             // BMP format
-            if (stbi_write_bmp(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.data()))
+            if (stbi_write_bmp(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.get()))
                 return true;
         }
         else if (extension == ".tga")
         {
             // TGA format
-            if (stbi_write_tga(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.data()))
+            if (stbi_write_tga(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.get()))
                 return true;
         }
         else if (extension == ".png")
         {
             // PNG format
-            if (stbi_write_png(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.data(), 0))
+            if (stbi_write_png(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.get(), 0))
                 return true;
         }
         else if (extension == ".jpg" || extension == ".jpeg")
         {
             // JPG format
-            if (stbi_write_jpg(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.data(), 90))
+            if (stbi_write_jpg(filename.string().c_str(), convertedSize.x, convertedSize.y, 4, m_pixels.get(), 90))
                 return true;
         }
         else
@@ -363,7 +857,7 @@ bool Image::saveToFile(const std::filesystem::path& filename) const
 std::optional<std::vector<std::uint8_t>> Image::saveToMemory(std::string_view format) const
 {
     // Make sure the image is not empty
-    if (!m_pixels.empty() && m_size.x > 0 && m_size.y > 0)
+    if (m_pixels && m_size.x > 0 && m_size.y > 0)
     {
         // Choose function based on format
         const std::string specified     = toLower(std::string(format));
@@ -374,25 +868,25 @@ std::optional<std::vector<std::uint8_t>> Image::saveToMemory(std::string_view fo
         if (specified == "bmp")
         {
             // BMP format
-            if (stbi_write_bmp_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.data()))
+            if (stbi_write_bmp_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.get()))
                 return buffer;
         }
         else if (specified == "tga")
         {
             // TGA format
-            if (stbi_write_tga_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.data()))
+            if (stbi_write_tga_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.get()))
                 return buffer;
         }
         else if (specified == "png")
         {
             // PNG format
-            if (stbi_write_png_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.data(), 0))
+            if (stbi_write_png_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.get(), 0))
                 return buffer;
         }
         else if (specified == "jpg" || specified == "jpeg")
         {
             // JPG format
-            if (stbi_write_jpg_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.data(), 90))
+            if (stbi_write_jpg_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.get(), 90))
                 return buffer;
         }
     }
@@ -413,17 +907,13 @@ Vector2u Image::getSize() const
 void Image::createMaskFromColor(Color color, std::uint8_t alpha)
 {
     // Make sure that the image is not empty
-    if (!m_pixels.empty())
+    if (m_pixels)
     {
         // Replace the alpha of the pixels that match the transparent color
-        std::uint8_t* ptr = m_pixels.data();
-        std::uint8_t* end = ptr + m_pixels.size();
-        while (ptr != end)
-        {
-            if ((ptr[0] == color.r) && (ptr[1] == color.g) && (ptr[2] == color.b) && (ptr[3] == color.a))
-                ptr[3] = alpha;
-            ptr += 4;
-        }
+        replacePixels(m_pixels.get(),
+                      std::size_t{m_size.x} * std::size_t{m_size.y},
+                      packPixel(color.r, color.g, color.b, color.a),
+                      packPixel(color.r, color.g, color.b, alpha));
     }
 }
 
@@ -467,8 +957,8 @@ bool Image::copy(const Image& source, Vector2u dest, const IntRect& sourceRect,
     const unsigned int srcStride = source.m_size.x * 4;
     const unsigned int dstStride = m_size.x * 4;
 
-    const std::uint8_t* srcPixels = source.m_pixels.data() + (srcRect.position.x + srcRect.position.y * source.m_size.x) * 4;
-    std::uint8_t* dstPixels = m_pixels.data() + (dest.x + dest.y * m_size.x) * 4;
+    const std::uint8_t* srcPixels = source.m_pixels.get() + (srcRect.position.x + srcRect.position.y * source.m_size.x) * 4;
+    std::uint8_t* dstPixels = m_pixels.get() + (dest.x + dest.y * m_size.x) * 4;
 
     // Copy the pixels
     if (applyAlpha)
@@ -485,6 +975,17 @@ bool Image::copy(const Image& source, Vector2u dest, const IntRect& sourceRect,
                 // Interpolate RGBA components using the alpha values of the destination and source pixels
                 const std::uint8_t srcAlpha = src[3];
                 const std::uint8_t dstAlpha = dst[3];
+
+                // Opaque source pixels replace the destination, transparent ones leave visible destination
+                // pixels untouched: skip the interpolation, which gives the same results in these cases
+                if (srcAlpha == 255)
+                {
+                    std::memcpy(dst, src, 4);
+                    continue;
+                }
+                if ((srcAlpha == 0) && (dstAlpha != 0))
+                    continue;
+
                 const auto outAlpha = static_cast<std::uint8_t>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
 
                 dst[3] = outAlpha;
@@ -546,9 +1047,9 @@ Color Image::getPixel(Vector2u coords) const
 ////////////////////////////////////////////////////////////
 const std::uint8_t* Image::getPixelsPtr() const
 {
-    if (!m_pixels.empty())
+    if (m_pixels)
     {
-        return m_pixels.data();
+        return m_pixels.get();
     }
 
     err() << "Trying to access the pixels of an empty image" << std::endl;
@@ -559,24 +1060,12 @@ const std::uint8_t* Image::getPixelsPtr() const
 ////////////////////////////////////////////////////////////
 void Image::flipHorizontally()
 {
-    if (!m_pixels.empty())
+    if (m_pixels)
     {
         const std::size_t rowSize = m_size.x * 4;
 
         for (std::size_t y = 0; y < m_size.y; ++y)
-        {
-            auto left = m_pixels.begin() + static_cast<std::vector<std::uint8_t>::iterator::difference_type>(y * rowSize);
-            auto right = m_pixels.begin() +
-                         static_cast<std::vector<std::uint8_t>::iterator::difference_type>((y + 1) * rowSize - 4);
-
-            for (std::size_t x = 0; x < m_size.x / 2; ++x)
-            {
-                std::swap_ranges(left, left + 4, right);
-
-                left += 4;
-                right -= 4;
-            }
-        }
+            reverseRow(m_pixels.get() + y * rowSize, m_size.x);
     }
 }
 
@@ -584,16 +1073,20 @@ void Image::flipHorizontally()
 ////////////////////////////////////////////////////////////
 void Image::flipVertically()
 {
-    if (!m_pixels.empty())
+    if (m_pixels)
     {
-        const auto rowSize = static_cast<std::vector<std::uint8_t>::iterator::difference_type>(m_size.x * 4);
+        const std::size_t rowSize = m_size.x * 4;
 
-        auto top    = m_pixels.begin();
-        auto bottom = m_pixels.end() - rowSize;
+        std::uint8_t* top    = m_pixels.get();
+        std::uint8_t* bottom = m_pixels.get() + (m_size.y - 1) * rowSize;
 
+        // Swap whole rows through a buffer, memcpy is much faster than swapping bytes one by one
+        std::vector<std::uint8_t> buffer(rowSize);
         for (std::size_t y = 0; y < m_size.y / 2; ++y)
         {
-            std::swap_ranges(top, top + rowSize, bottom);
+            std::memcpy(buffer.data(), top, rowSize);
+            std::memcpy(top, bottom, rowSize);
+            std::memcpy(bottom, buffer.data(), rowSize);
 
             top += rowSize;
             bottom -= rowSize;
@@ -601,4 +1094,35 @@ void Image::flipVertically()
     }
 }
 
+
+////////////////////////////////////////////////////////////
+Image Image::resample(Vector2u size, ResampleFilter filter, bool sRgb, unsigned int threadCount) const
+{
+    if (!m_pixels || size.x == 0 || size.y == 0)
+        return {};
+
+    const FloatImage source = toFloatImage(m_pixels.get(), m_size, sRgb);
+    return toImage(resamplePixels(source, size, filter, threadCount), sRgb);
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<Image> Image::createMipmap(ResampleFilter filter, bool sRgb, unsigned int threadCount) const
+{
+    std::vector<Image> levels;
+    if (!m_pixels)
+        return levels;
+
+    // Each level is computed from the previous one before it gets quantized, to avoid accumulating rounding errors
+    FloatImage level = toFloatImage(m_pixels.get(), m_size, sRgb);
+    while (level.size.x > 1 || level.size.y > 1)
+    {
+        const Vector2u size(std::max(level.size.x / 2, 1u), std::max(level.size.y / 2, 1u));
+        level = resamplePixels(level, size, filter, threadCount);
+        levels.push_back(toImage(level, sRgb));
+    }
+
+    return levels;
+}
+
 } // namespace sf
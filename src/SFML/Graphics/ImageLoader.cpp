@@ -0,0 +1,251 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ImageLoader.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct ImageLoader::Impl
+{
+    explicit Impl(std::vector<std::filesystem::path> theFilenames) : filenames(std::move(theFilenames))
+    {
+    }
+
+    ~Impl()
+    {
+        cancel();
+
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+
+    Impl(const Impl&)            = delete;
+    Impl& operator=(const Impl&) = delete;
+
+    // Decode the next file of the list, return false when there is nothing left to do
+    bool processNext()
+    {
+        const std::size_t index = nextIndex.fetch_add(1);
+        if ((index >= filenames.size()) || cancelled)
+            return false;
+
+        Result result{index, std::nullopt};
+        if (Image image; image.loadFromFile(filenames[index]))
+            result.image = std::move(image);
+
+        {
+            const std::lock_guard lock(mutex);
+
+            // Results of a cancelled loading are dropped
+            if (!cancelled)
+                finished.push_back(std::move(result));
+
+            ++processedCount;
+        }
+
+        condition.notify_one();
+        return true;
+    }
+
+    std::optional<Result> next(bool wait)
+    {
+        // Without worker threads, decode the files on the calling thread
+        if (threads.empty() && wait)
+            processNext();
+
+        std::unique_lock lock(mutex);
+
+        if (wait)
+            condition.wait(lock,
+                           [this] { return cancelled || !finished.empty() || (returnedCount == filenames.size()); });
+
+        if (cancelled || finished.empty())
+            return std::nullopt;
+
+        Result result = std::move(finished.front());
+        finished.pop_front();
+        ++returnedCount;
+        return result;
+    }
+
+    void cancel()
+    {
+        {
+            const std::lock_guard lock(mutex);
+            cancelled = true;
+            finished.clear();
+        }
+
+        condition.notify_all();
+    }
+
+    const std::vector<std::filesystem::path> filenames;        //!< Files to load
+    std::atomic<std::size_t>                 nextIndex{};      //!< Index of the next file to decode
+    std::atomic<std::size_t>                 processedCount{}; //!< Number of files decoded so far
+    std::atomic<bool>                        cancelled{};      //!< Was the loading cancelled?
+    std::mutex                               mutex;            //!< Mutex protecting the results
+    std::condition_variable                  condition;        //!< Signaled when a result is ready
+    std::deque<Result>                       finished;         //!< Results not returned yet
+    std::size_t                              returnedCount{};  //!< Number of results returned so far
+    std::vector<std::thread>                 threads;          //!< Worker threads
+};
+
+
+////////////////////////////////////////////////////////////
+ImageLoader::ImageLoader(std::vector<std::filesystem::path> filenames, unsigned int threadCount) :
+m_impl(std::make_unique<Impl>(std::move(filenames)))
+{
+    if (threadCount == 0)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    const std::size_t count = std::min(std::size_t{threadCount}, m_impl->filenames.size());
+
+    try
+    {
+        m_impl->threads.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            m_impl->threads.emplace_back(
+                [impl = m_impl.get()]
+                {
+                    while (impl->processNext())
+                    {
+                    }
+                });
+    }
+    catch (const std::system_error& error)
+    {
+        // The threads that did start handle the whole list, or the files are loaded when results are requested
+        err() << "Failed to start image loading threads: " << error.what() << std::endl;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+ImageLoader::~ImageLoader() = default;
+
+
+////////////////////////////////////////////////////////////
+ImageLoader::ImageLoader(ImageLoader&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+ImageLoader& ImageLoader::operator=(ImageLoader&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+std::size_t ImageLoader::getCount() const
+{
+    return m_impl->filenames.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ImageLoader::getProcessedCount() const
+{
+    return m_impl->processedCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void ImageLoader::cancel()
+{
+    m_impl->cancel();
+}
+
+
+////////////////////////////////////////////////////////////
+bool ImageLoader::isCancelled() const
+{
+    return m_impl->cancelled;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<ImageLoader::Result> ImageLoader::waitNext()
+{
+    return m_impl->next(true);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<ImageLoader::Result> ImageLoader::pollNext()
+{
+    return m_impl->next(false);
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<std::optional<Image>> ImageLoader::waitForImages()
+{
+    std::vector<std::optional<Image>> images(m_impl->filenames.size());
+
+    while (std::optional<Result> result = waitNext())
+        images[result->index] = std::move(result->image);
+
+    return images;
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<std::optional<Texture>> ImageLoader::uploadTextures(
+    bool                                                 sRgb,
+    const std::function<void(std::size_t, std::size_t)>& onProgress)
+{
+    std::vector<std::optional<Texture>> textures(m_impl->filenames.size());
+
+    // Upload each image as soon as it is decoded, while the worker threads keep decoding the next ones
+    while (std::optional<Result> result = waitNext())
+    {
+        if (result->image)
+        {
+            Texture texture;
+            if (texture.loadFromImage(*result->image, sRgb))
+                textures[result->index] = std::move(texture);
+        }
+
+        if (onProgress)
+            onProgress(m_impl->returnedCount, m_impl->filenames.size());
+    }
+
+    return textures;
+}
+
+} // namespace sf
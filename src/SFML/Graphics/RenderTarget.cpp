@@ -28,6 +28,7 @@
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
@@ -39,9 +40,13 @@
 #include <SFML/System/Err.hpp>
 
 #include <algorithm>
+#include <memory>
 #include <mutex>
 #include <ostream>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <cassert>
 #include <cmath>
@@ -191,15 +196,173 @@ std::uint32_t stencilFunctionToGlConstant(sf::StencilComparison comparison)
     assert(false);
     return GL_ALWAYS;
 }
+
+
+// Convert a primitive type to the corresponding OpenGL constant.
+GLenum primitiveTypeToGlConstant(sf::PrimitiveType type)
+{
+    static constexpr sf::priv::EnumArray<sf::PrimitiveType, GLenum, 6> modes =
+        {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
+
+    return modes[type];
+}
+
+
+// Targets of the calling thread which have pending batched vertices that sample a texture, so that they can be
+// rendered before the pixels of the texture are moved; the entries expire when the batches are flushed or
+// when the targets are destroyed, from any thread
+using BatchingTargetList = std::vector<std::weak_ptr<sf::RenderTarget*>>;
+BatchingTargetList& getBatchingTargets()
+{
+    thread_local BatchingTargetList batchingTargets;
+    return batchingTargets;
+}
+
+
+// Convert a primitive type to the list type that it is appended as when batching
+// (strips and fans can't be concatenated, so they are split into independent primitives)
+sf::PrimitiveType toListPrimitiveType(sf::PrimitiveType type)
+{
+    switch (type)
+    {
+        case sf::PrimitiveType::Points:
+            return sf::PrimitiveType::Points;
+        case sf::PrimitiveType::Lines:
+        case sf::PrimitiveType::LineStrip:
+            return sf::PrimitiveType::Lines;
+        case sf::PrimitiveType::Triangles:
+        case sf::PrimitiveType::TriangleStrip:
+        case sf::PrimitiveType::TriangleFan:
+            return sf::PrimitiveType::Triangles;
+    }
+
+    assert(false);
+    return type;
+}
+
+
+// Check whether two sets of render states can be rendered by the same batch
+// (the transform is ignored since batched vertices are pre-transformed)
+bool canShareBatch(const sf::RenderStates& lhs, const sf::RenderStates& rhs)
+{
+    return (lhs.blendMode == rhs.blendMode) && (lhs.stencilMode == rhs.stencilMode) &&
+           (lhs.coordinateType == rhs.coordinateType) && (lhs.texture == rhs.texture) && (lhs.shader == rhs.shader);
+}
+
+
+// Append the pre-transformed primitives made of `count` vertices to a list of vertices
+// (strips and fans are split into independent primitives, see toListPrimitiveType)
+template <typename GetVertex>
+void appendPrimitives(std::vector<sf::Vertex>& output,
+                      sf::PrimitiveType        type,
+                      std::size_t              count,
+                      const sf::Transform&     transform,
+                      GetVertex                getVertex)
+{
+    const auto append = [&output, &transform, &getVertex](std::size_t index)
+    {
+        const sf::Vertex& vertex = getVertex(index);
+        output.push_back({transform * vertex.position, vertex.color, vertex.texCoords});
+    };
+
+    switch (type)
+    {
+        case sf::PrimitiveType::Points:
+        case sf::PrimitiveType::Lines:
+        case sf::PrimitiveType::Triangles:
+        {
+            // Drop incomplete trailing primitives, they would shift the ones that follow
+            const std::size_t primitiveSize = (type == sf::PrimitiveType::Points)  ? 1
+                                              : (type == sf::PrimitiveType::Lines) ? 2
+                                                                                   : 3;
+            count -= count % primitiveSize;
+
+            output.reserve(output.size() + count);
+            for (std::size_t i = 0; i < count; ++i)
+                append(i);
+            break;
+        }
+        case sf::PrimitiveType::LineStrip:
+        {
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                append(i - 1);
+                append(i);
+            }
+            break;
+        }
+        case sf::PrimitiveType::TriangleStrip:
+        {
+            for (std::size_t i = 2; i < count; ++i)
+            {
+                append(i - 2);
+                append(i - 1);
+                append(i);
+            }
+            break;
+        }
+        case sf::PrimitiveType::TriangleFan:
+        {
+            for (std::size_t i = 2; i < count; ++i)
+            {
+                append(0);
+                append(i - 1);
+                append(i);
+            }
+            break;
+        }
+    }
+}
 } // namespace RenderTargetImpl
 } // namespace
 
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+RenderTarget::RenderTarget(RenderTarget&& source) noexcept :
+m_defaultView(std::move(source.m_defaultView)),
+m_view(std::move(source.m_view)),
+m_cache(source.m_cache),
+m_batch(std::move(source.m_batch)),
+m_id(source.m_id)
+{
+    // The pending batch now belongs to this target
+    if (m_batch.registration)
+        *m_batch.registration = this;
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTarget& RenderTarget::operator=(RenderTarget&& right) noexcept
+{
+    // Catch self-moving.
+    if (&right == this)
+        return *this;
+
+    // Render the pending draws of this target before they get replaced by the ones of the other target
+    flush();
+
+    m_defaultView = std::move(right.m_defaultView);
+    m_view        = std::move(right.m_view);
+    m_cache       = right.m_cache;
+    m_batch       = std::move(right.m_batch);
+    m_id          = right.m_id;
+
+    // The pending batch of the other target now belongs to this one
+    if (m_batch.registration)
+        *m_batch.registration = this;
+
+    return *this;
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(Color color)
 {
+    // Render the pending draws before they get cleared
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -218,6 +381,9 @@ void RenderTarget::clear(Color color)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clearStencil(StencilValue stencilValue)
 {
+    // Render the pending draws before they get cleared
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -236,6 +402,9 @@ void RenderTarget::clearStencil(StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(Color color, StencilValue stencilValue)
 {
+    // Render the pending draws before they get cleared
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -255,6 +424,9 @@ void RenderTarget::clear(Color color, StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::setView(const View& view)
 {
+    // The pending draws must be rendered with the previous view
+    flush();
+
     m_view              = view;
     m_cache.viewChanged = true;
 }
@@ -352,65 +524,25 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
     if (!vertices || (vertexCount == 0))
         return;
 
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    if (m_batch.enabled)
     {
-        // Check if the vertex count is low enough so that we can pre-transform them
-        const bool useVertexCache = (vertexCount <= m_cache.vertexCache.size());
-
-        if (useVertexCache)
-        {
-            // Pre-transform the vertices and store them into the vertex cache
-            for (std::size_t i = 0; i < vertexCount; ++i)
-            {
-                Vertex& vertex   = m_cache.vertexCache[i];
-                vertex.position  = states.transform * vertices[i].position;
-                vertex.color     = vertices[i].color;
-                vertex.texCoords = vertices[i].texCoords;
-            }
-        }
-
-        setupDraw(useVertexCache, states);
-
-        // Check if texture coordinates array is needed, and update client state accordingly
-        const bool enableTexCoordsArray = (states.texture || states.shader);
-        if (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled))
-        {
-            if (enableTexCoordsArray)
-                glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
-            else
-                glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
-        }
+        ++m_batch.frameStatistics.drawCalls;
 
-        // If we switch between non-cache and cache mode or enable texture
-        // coordinates we need to set up the pointers to the vertices' components
-        if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
+        if (prepareBatch(type, states))
         {
-            const auto* data = reinterpret_cast<const std::byte*>(vertices);
-
-            // If we pre-transform the vertices, we must use our internal vertex cache
-            if (useVertexCache)
-                data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
-
-            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
-            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
-            if (enableTexCoordsArray)
-                glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
-        }
-        else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
-        {
-            // If we enter this block, we are already using our internal vertex cache
-            const auto* data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
-
-            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+            RenderTargetImpl::appendPrimitives(m_batch.vertices,
+                                               type,
+                                               vertexCount,
+                                               states.transform,
+                                               [vertices](std::size_t i) -> const Vertex& { return vertices[i]; });
+            return;
         }
 
-        drawPrimitives(type, 0, vertexCount);
-        cleanupDraw(states);
-
-        // Update the cache
-        m_cache.useVertexCache        = useVertexCache;
-        m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
+        // Draws that can't be batched must be rendered after the pending ones
+        flush();
     }
+
+    drawVertices(vertices, vertexCount, type, states);
 }
 
 
@@ -442,6 +574,9 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
     if (!vertexCount || !vertexBuffer.getNativeHandle())
         return;
 
+    // Vertex buffers are never batched, render the pending vertices first
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         setupDraw(false, states);
@@ -471,6 +606,158 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Vertex*        vertices,
+                        std::size_t          vertexCount,
+                        const std::uint16_t* indices,
+                        std::size_t          indexCount,
+                        PrimitiveType        type,
+                        const RenderStates&  states)
+{
+    drawIndexed(vertices, vertexCount, indices, indexCount, type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Vertex*        vertices,
+                        std::size_t          vertexCount,
+                        const std::uint32_t* indices,
+                        std::size_t          indexCount,
+                        PrimitiveType        type,
+                        const RenderStates&  states)
+{
+    drawIndexed(vertices, vertexCount, indices, indexCount, type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const IndexBuffer& indexBuffer, const RenderStates& states)
+{
+    draw(vertexBuffer, indexBuffer, 0, indexBuffer.getIndexCount(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer,
+                        const IndexBuffer&  indexBuffer,
+                        std::size_t         firstIndex,
+                        std::size_t         indexCount,
+                        const RenderStates& states)
+{
+    // IndexBuffer not supported?
+    if (!IndexBuffer::isAvailable())
+    {
+        err() << "sf::IndexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Sanity check
+    if (firstIndex > indexBuffer.getIndexCount())
+        return;
+
+    // Clamp indexCount to something that makes sense
+    indexCount = std::min(indexCount, indexBuffer.getIndexCount() - firstIndex);
+
+    // Nothing to draw?
+    if (!indexCount || !vertexBuffer.getNativeHandle() || !indexBuffer.getNativeHandle())
+        return;
+
+    // Vertex buffers are never batched, render the pending vertices first
+    flush();
+
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        setupDraw(false, states);
+
+        // Bind vertex and index buffers
+        VertexBuffer::bind(&vertexBuffer);
+        IndexBuffer::bind(&indexBuffer);
+
+        // Always enable texture coordinates
+        if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+
+        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
+        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
+        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+
+        // With an index buffer bound, the index pointer is an offset in the buffer
+        const std::size_t indexSize = (indexBuffer.getIndexType() == IndexBuffer::IndexType::UInt32)
+                                          ? sizeof(std::uint32_t)
+                                          : sizeof(std::uint16_t);
+
+        drawIndexedPrimitives(vertexBuffer.getPrimitiveType(),
+                              reinterpret_cast<const void*>(firstIndex * indexSize),
+                              indexSize,
+                              indexCount);
+
+        // Unbind vertex and index buffers
+        IndexBuffer::bind(nullptr);
+        VertexBuffer::bind(nullptr);
+
+        cleanupDraw(states);
+
+        // Update the cache
+        m_cache.useVertexCache        = false;
+        m_cache.texCoordsArrayEnabled = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setBatchingEnabled(bool enabled)
+{
+    if (!enabled)
+        flush();
+
+    m_batch.enabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isBatchingEnabled() const
+{
+    return m_batch.enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::flush()
+{
+    if (m_batch.vertices.empty())
+    {
+        // Primitives too short to add any vertex can still have started the batch
+        m_batch.textureGuard.reset();
+        return;
+    }
+
+    // Detach the pending vertices first, so that the batch is seen as empty
+    // by any function that is called while rendering it
+    std::vector<Vertex> vertices = std::move(m_batch.vertices);
+    m_batch.vertices.clear();
+    m_batch.registration.reset();
+
+    drawVertices(vertices.data(), vertices.size(), m_batch.type, m_batch.states);
+
+    ++m_batch.frameStatistics.batches;
+    m_batch.frameStatistics.vertices += vertices.size();
+
+    // The texture can move its pixels again once no batch holds it
+    m_batch.textureGuard.reset();
+
+    // Give the storage back to the batch so that it can be reused without reallocating
+    vertices.clear();
+    m_batch.vertices = std::move(vertices);
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderTarget::BatchStatistics& RenderTarget::getBatchStatistics() const
+{
+    return m_batch.lastStatistics;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool RenderTarget::isSrgb() const
 {
@@ -522,6 +809,8 @@ bool RenderTarget::setActive(bool active)
 ////////////////////////////////////////////////////////////
 void RenderTarget::pushGLStates()
 {
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
 #ifdef SFML_DEBUG
@@ -553,6 +842,8 @@ void RenderTarget::pushGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::popGLStates()
 {
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         glCheck(glMatrixMode(GL_PROJECTION));
@@ -624,7 +915,10 @@ void RenderTarget::resetGLStates()
             applyShader(nullptr);
 
         if (vertexBufferAvailable)
+        {
             glCheck(VertexBuffer::bind(nullptr));
+            glCheck(IndexBuffer::bind(nullptr));
+        }
 
         m_cache.texCoordsArrayEnabled = true;
 
@@ -654,6 +948,16 @@ void RenderTarget::initialize()
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::finishFrame()
+{
+    flush();
+
+    m_batch.lastStatistics  = m_batch.frameStatistics;
+    m_batch.frameStatistics = BatchStatistics();
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::applyCurrentView()
 {
@@ -814,6 +1118,191 @@ void RenderTarget::applyShader(const Shader* shader)
 }
 
 
+////////////////////////////////////////////////////////////
+template <typename Index>
+void RenderTarget::drawIndexed(const Vertex*       vertices,
+                               std::size_t         vertexCount,
+                               const Index*        indices,
+                               std::size_t         indexCount,
+                               PrimitiveType       type,
+                               const RenderStates& states)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0) || !indices || (indexCount == 0))
+        return;
+
+    const auto getVertex = [vertices, indices](std::size_t i) -> const Vertex& { return vertices[indices[i]]; };
+
+    if (m_batch.enabled)
+    {
+        ++m_batch.frameStatistics.drawCalls;
+
+        if (prepareBatch(type, states))
+        {
+            RenderTargetImpl::appendPrimitives(m_batch.vertices, type, indexCount, states.transform, getVertex);
+            return;
+        }
+
+        // Draws that can't be batched must be rendered after the pending ones
+        flush();
+    }
+
+    if constexpr (std::is_same_v<Index, std::uint32_t> && !GLEXT_element_index_uint)
+    {
+        // 32-bit indices are not supported, assemble the primitives on the CPU instead
+        std::vector<Vertex> primitives;
+        RenderTargetImpl::appendPrimitives(primitives, type, indexCount, Transform::Identity, getVertex);
+
+        if (!primitives.empty())
+            drawVertices(primitives.data(), primitives.size(), RenderTargetImpl::toListPrimitiveType(type), states);
+    }
+    else
+    {
+        drawVertices(vertices, vertexCount, type, states, indices, sizeof(Index), indexCount);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawVertices(const Vertex*       vertices,
+                                std::size_t         vertexCount,
+                                PrimitiveType       type,
+                                const RenderStates& states,
+                                const void*         indices,
+                                std::size_t         indexSize,
+                                std::size_t         indexCount)
+{
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        // Check if the vertex count is low enough so that we can pre-transform them
+        const bool useVertexCache = (vertexCount <= m_cache.vertexCache.size());
+
+        if (useVertexCache)
+        {
+            // Pre-transform the vertices and store them into the vertex cache
+            for (std::size_t i = 0; i < vertexCount; ++i)
+            {
+                Vertex& vertex   = m_cache.vertexCache[i];
+                vertex.position  = states.transform * vertices[i].position;
+                vertex.color     = vertices[i].color;
+                vertex.texCoords = vertices[i].texCoords;
+            }
+        }
+
+        setupDraw(useVertexCache, states);
+
+        // Check if texture coordinates array is needed, and update client state accordingly
+        const bool enableTexCoordsArray = (states.texture || states.shader);
+        if (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled))
+        {
+            if (enableTexCoordsArray)
+                glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+            else
+                glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
+        }
+
+        // If we switch between non-cache and cache mode or enable texture
+        // coordinates we need to set up the pointers to the vertices' components
+        if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
+        {
+            const auto* data = reinterpret_cast<const std::byte*>(vertices);
+
+            // If we pre-transform the vertices, we must use our internal vertex cache
+            if (useVertexCache)
+                data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+
+            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
+            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
+            if (enableTexCoordsArray)
+                glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+        }
+        else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
+        {
+            // If we enter this block, we are already using our internal vertex cache
+            const auto* data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+
+            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+        }
+
+        if (indices)
+            drawIndexedPrimitives(type, indices, indexSize, indexCount);
+        else
+            drawPrimitives(type, 0, vertexCount);
+
+        cleanupDraw(states);
+
+        // Update the cache
+        m_cache.useVertexCache        = useVertexCache;
+        m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::prepareBatch(PrimitiveType type, const RenderStates& states)
+{
+    // Textures attached to a FBO must be rebound for every draw, see setupDraw
+    if (states.texture && states.texture->m_fboAttachment)
+        return false;
+
+    const PrimitiveType batchType = RenderTargetImpl::toListPrimitiveType(type);
+
+    // Vertices rendered with other states can't join the pending ones
+    if (!m_batch.vertices.empty() &&
+        ((batchType != m_batch.type) || !RenderTargetImpl::canShareBatch(m_batch.states, states)))
+        flush();
+
+    if (m_batch.vertices.empty())
+    {
+        m_batch.states           = states;
+        m_batch.states.transform = Transform::Identity;
+        m_batch.type             = batchType;
+
+        // Let the texture flush the batch if its pixels are moved by this thread while the vertices are pending,
+        // and keep other threads from moving them until then
+        if (states.texture)
+        {
+            RenderTargetImpl::BatchingTargetList& targets = RenderTargetImpl::getBatchingTargets();
+            targets.erase(std::remove_if(targets.begin(),
+                                         targets.end(),
+                                         [](const std::weak_ptr<RenderTarget*>& target) { return target.expired(); }),
+                          targets.end());
+
+            m_batch.textureGuard = states.texture->m_batchGuard;
+            m_batch.registration = std::make_shared<RenderTarget*>(this);
+            targets.push_back(m_batch.registration);
+        }
+    }
+    else
+    {
+        ++m_batch.frameStatistics.mergedDraws;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::flushBatches(const Texture& texture)
+{
+    // Only the targets of the calling thread can be flushed here: the batches of the other threads
+    // aren't protected against concurrent accesses, and their contexts can't be activated here
+    std::vector<RenderTarget*> targets;
+    for (const std::weak_ptr<RenderTarget*>& entry : RenderTargetImpl::getBatchingTargets())
+    {
+        if (const std::shared_ptr<RenderTarget*> target = entry.lock())
+        {
+            if ((*target)->m_batch.states.texture == &texture)
+                targets.push_back(*target);
+        }
+    }
+
+    // Flushing a target expires its entry, which is why they are flushed after iterating over the list
+    for (RenderTarget* target : targets)
+        target->flush();
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 {
@@ -890,15 +1379,28 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 void RenderTarget::drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount)
 {
     // Find the OpenGL primitive type
-    static constexpr priv::EnumArray<PrimitiveType, GLenum, 6> modes =
-        {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
-    const GLenum mode = modes[type];
+    const GLenum mode = RenderTargetImpl::primitiveTypeToGlConstant(type);
 
     // Draw the primitives
     glCheck(glDrawArrays(mode, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount)));
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::drawIndexedPrimitives(PrimitiveType type,
+                                         const void*   indices,
+                                         std::size_t   indexSize,
+                                         std::size_t   indexCount)
+{
+    // Find the OpenGL primitive and index types
+    const GLenum mode      = RenderTargetImpl::primitiveTypeToGlConstant(type);
+    const GLenum indexType = (indexSize == sizeof(std::uint32_t)) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+
+    // Draw the primitives
+    glCheck(glDrawElements(mode, static_cast<GLsizei>(indexCount), indexType, indices));
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::cleanupDraw(const RenderStates& states)
 {
@@ -938,6 +1440,15 @@ void RenderTarget::cleanupDraw(const RenderStates& states)
 //   pre-transform them and therefore use an identity transform
 //   to render them.
 //
+// * Batching
+//   When batching is enabled, the vertices of consecutive draws
+//   sharing the same states (except for the transform) are
+//   pre-transformed and accumulated in a single vertex stream,
+//   which is rendered with one draw call once the states change.
+//   Strips and fans are split into independent primitives so
+//   that they can be concatenated with other geometry, and
+//   indexed geometry is expanded into the stream.
+//
 // * Blending mode
 //   Since it overloads the == operator, we can easily check
 //   whether any of the 6 blending components changed and,
@@ -182,6 +182,9 @@ void RenderTexture::display()
             return;
     }
 
+    // Render the pending batched draws
+    finishFrame();
+
     // Update the target texture
     m_impl->updateTexture(m_texture.m_texture);
     m_texture.m_pixelsFlipped = true;
@@ -0,0 +1,230 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderTexturePool.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <cassert>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace RenderTexturePoolImpl
+{
+// Tell whether render textures created with the given settings are interchangeable
+bool isCompatible(const sf::ContextSettings& left, const sf::ContextSettings& right)
+{
+    return (left.depthBits == right.depthBits) && (left.stencilBits == right.stencilBits) &&
+           (left.antiAliasingLevel == right.antiAliasingLevel) && (left.sRgbCapable == right.sRgbCapable);
+}
+} // namespace RenderTexturePoolImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+RenderTexturePool::Lease::Lease(RenderTexturePool& pool, RenderTexture& renderTexture) :
+m_pool(&pool),
+m_renderTexture(&renderTexture)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::Lease::~Lease()
+{
+    if (m_pool)
+        m_pool->release(*m_renderTexture);
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::Lease::Lease(Lease&& source) noexcept :
+m_pool(std::exchange(source.m_pool, nullptr)),
+m_renderTexture(std::exchange(source.m_renderTexture, nullptr))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::Lease& RenderTexturePool::Lease::operator=(Lease&& right) noexcept
+{
+    // Make sure we aren't moving ourselves.
+    if (&right == this)
+    {
+        return *this;
+    }
+
+    if (m_pool)
+        m_pool->release(*m_renderTexture);
+
+    m_pool          = std::exchange(right.m_pool, nullptr);
+    m_renderTexture = std::exchange(right.m_renderTexture, nullptr);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexture& RenderTexturePool::Lease::operator*() const
+{
+    assert(m_renderTexture && "RenderTexturePool::Lease::operator*() Cannot access a moved-from lease");
+    return *m_renderTexture;
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexture* RenderTexturePool::Lease::operator->() const
+{
+    assert(m_renderTexture && "RenderTexturePool::Lease::operator->() Cannot access a moved-from lease");
+    return m_renderTexture;
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::RenderTexturePool() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::~RenderTexturePool()
+{
+    assert(std::none_of(m_entries.begin(), m_entries.end(), [](const Entry& entry) { return entry.leased; }) &&
+           "RenderTexturePool::~RenderTexturePool() All leases must be destroyed before the pool");
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::Lease RenderTexturePool::acquire(Vector2u size, const ContextSettings& settings)
+{
+    // Reuse an idle render texture created with the same parameters
+    const auto it = std::find_if(m_entries.begin(),
+                                 m_entries.end(),
+                                 [&](const Entry& entry)
+                                 {
+                                     return !entry.leased && (entry.renderTexture->getSize() == size) &&
+                                            RenderTexturePoolImpl::isCompatible(entry.settings, settings);
+                                 });
+
+    if (it != m_entries.end())
+    {
+        it->lastUsed = m_generation;
+        it->leased   = true;
+        return {*this, *it->renderTexture};
+    }
+
+    // None available, create a new one (throws if it fails)
+    Entry& entry = m_entries.emplace_back(Entry{std::make_unique<RenderTexture>(size, settings), settings});
+
+    entry.lastUsed = m_generation;
+    entry.leased   = true;
+    return {*this, *entry.renderTexture};
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::nextGeneration()
+{
+    ++m_generation;
+
+    // Destroy the render textures that have been idle for too long
+    m_entries.erase(std::remove_if(m_entries.begin(),
+                                   m_entries.end(),
+                                   [this](const Entry& entry)
+                                   { return !entry.leased && (m_generation - entry.lastUsed > m_maxIdleGenerations); }),
+                    m_entries.end());
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t RenderTexturePool::getGeneration() const
+{
+    return m_generation;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::setMaxIdleGenerations(unsigned int generations)
+{
+    m_maxIdleGenerations = generations;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int RenderTexturePool::getMaxIdleGenerations() const
+{
+    return m_maxIdleGenerations;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getCount() const
+{
+    return m_entries.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getIdleCount() const
+{
+    return static_cast<std::size_t>(
+        std::count_if(m_entries.begin(), m_entries.end(), [](const Entry& entry) { return !entry.leased; }));
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::clear()
+{
+    const auto isIdle = [](const Entry& entry) { return !entry.leased; };
+    m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(), isIdle), m_entries.end());
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::release(RenderTexture& renderTexture)
+{
+    const auto it = std::find_if(m_entries.begin(),
+                                 m_entries.end(),
+                                 [&](const Entry& entry) { return entry.renderTexture.get() == &renderTexture; });
+    assert(it != m_entries.end() && "RenderTexturePool::release() Render texture doesn't belong to the pool");
+
+    // Render the pending batch while the previous user's resources are still alive, then
+    // reset the state that they may have changed so that the next lease starts from scratch
+    renderTexture.setBatchingEnabled(false);
+    renderTexture.display(); // also drops a mipmap generated by the previous user
+    renderTexture.setSmooth(false);
+    renderTexture.setRepeated(false);
+    renderTexture.setView(renderTexture.getDefaultView());
+
+    it->lastUsed = m_generation;
+    it->leased   = false;
+}
+
+} // namespace sf
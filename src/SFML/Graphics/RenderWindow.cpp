@@ -125,4 +125,12 @@ void RenderWindow::onResize()
     setView(getView());
 }
 
+
+////////////////////////////////////////////////////////////
+void RenderWindow::onDisplay()
+{
+    // Render the pending batched draws before swapping the buffers
+    finishFrame();
+}
+
 } // namespace sf
@@ -30,6 +30,7 @@
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
 
 #include <SFML/Window/GlResource.hpp>
 
@@ -40,11 +41,18 @@
 #include <SFML/System/Vector2.hpp>
 #include <SFML/System/Vector3.hpp>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <ostream>
+#include <random>
+#include <sstream>
+#include <type_traits>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include <cstdint>
@@ -65,6 +73,14 @@
 
 namespace
 {
+// Unique identifier of a linked program, so that uniform handles can tell whether they were
+// created for the current program (OpenGL may give the name of a deleted program to a new one)
+std::uint64_t getUniqueProgramId()
+{
+    static std::atomic<std::uint64_t> id(1); // start at 1, zero is "no program"
+    return id++;
+}
+
 // Retrieve the maximum number of texture units available
 std::size_t getMaxTextureUnits()
 {
@@ -79,6 +95,20 @@ std::size_t getMaxTextureUnits()
     return static_cast<std::size_t>(maxUnits);
 }
 
+// Retrieve the maximum number of uniform buffer binding points available
+std::size_t getMaxUniformBufferBindings()
+{
+    static const GLint maxBindings = []
+    {
+        GLint value = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_MAX_UNIFORM_BUFFER_BINDINGS, &value));
+
+        return value;
+    }();
+
+    return static_cast<std::size_t>(maxBindings);
+}
+
 // Read the contents of a file into an array of char
 bool getFileContents(const std::filesystem::path& filename, std::vector<char>& buffer)
 {
@@ -121,52 +151,227 @@ bool getStreamContents(sf::InputStream& stream, std::vector<char>& buffer)
     return success;
 }
 
-// Transforms an array of 2D vectors into a contiguous array of scalars
-std::vector<float> flatten(const sf::Vector2f* vectorArray, std::size_t length)
+// View an array of vectors or matrices as the contiguous array of scalars that OpenGL expects,
+// their layout allows it to be uploaded directly without copying it first
+template <std::size_t ScalarCount, typename T>
+const float* asScalarArray(const T* array)
+{
+    static_assert(std::is_standard_layout_v<T> && (sizeof(T) == ScalarCount * sizeof(float)),
+                  "Type must consist of exactly ScalarCount tightly packed floats");
+    return reinterpret_cast<const float*>(array);
+}
+
+// Directory of the program binary cache, empty when the cache is disabled
+struct BinaryCacheDirectory
+{
+    std::mutex            mutex;
+    std::filesystem::path path;
+};
+
+BinaryCacheDirectory& getBinaryCacheDirectory()
+{
+    static BinaryCacheDirectory directory;
+    return directory;
+}
+
+// Header written in front of each program binary stored in the cache
+struct ProgramBinaryHeader
+{
+    std::uint64_t magic{0x314e'4942'4c4d'4653}; // "SFMLBIN1"
+    std::uint64_t sourceHash{};                 // Hash of the sources the program was linked from
+    std::uint64_t driverHash{};                 // Hash of the strings identifying the driver
+    std::uint32_t format{};                     // Driver specific format of the binary
+    std::uint32_t length{};                     // Size of the binary, in bytes
+};
+
+// Hash a sequence of bytes with FNV-1a, continuing from a previous hash
+constexpr std::uint64_t hashOffsetBasis = 0xcbf2'9ce4'8422'2325;
+
+std::uint64_t hashBytes(std::string_view bytes, std::uint64_t hash)
+{
+    for (const char byte : bytes)
+    {
+        hash ^= static_cast<unsigned char>(byte);
+        hash *= 0x100'0000'01b3;
+    }
+
+    return hash;
+}
+
+// Build the cache header identifying a program linked from the given sources by the current driver
+ProgramBinaryHeader makeProgramBinaryHeader(std::string_view vertexShaderCode,
+                                            std::string_view geometryShaderCode,
+                                            std::string_view fragmentShaderCode)
 {
-    const std::size_t vectorSize = 2;
+    // A separator is hashed after each string so that moving code between stages changes the hash
+    static constexpr std::string_view separator("", 1);
+
+    ProgramBinaryHeader header;
+
+    header.sourceHash = hashOffsetBasis;
+    for (const std::string_view code : {vertexShaderCode, geometryShaderCode, fragmentShaderCode})
+        header.sourceHash = hashBytes(separator, hashBytes(code, header.sourceHash));
 
-    std::vector<float> contiguous(vectorSize * length);
-    for (std::size_t i = 0; i < length; ++i)
+    header.driverHash = hashOffsetBasis;
+    for (const GLenum name : {GLenum{GL_VENDOR}, GLenum{GL_RENDERER}, GLenum{GL_VERSION}})
     {
-        contiguous[vectorSize * i]     = vectorArray[i].x;
-        contiguous[vectorSize * i + 1] = vectorArray[i].y;
+        const auto* string = reinterpret_cast<const char*>(glCheck(glGetString(name)));
+        header.driverHash  = hashBytes(separator, hashBytes(string ? string : "", header.driverHash));
     }
 
-    return contiguous;
+    return header;
 }
 
-// Transforms an array of 3D vectors into a contiguous array of scalars
-std::vector<float> flatten(const sf::Vector3f* vectorArray, std::size_t length)
+// Get the name of the cache entry of a program
+std::string getProgramBinaryFileName(const ProgramBinaryHeader& header)
 {
-    const std::size_t vectorSize = 3;
+    std::ostringstream name;
+    name << std::hex << std::setfill('0') << std::setw(16) << header.sourceHash << std::setw(16) << header.driverHash
+         << ".bin";
+    return name.str();
+}
+
+// Restore a program from the cache, the entry is removed if the driver can't use it anymore
+GLEXT_GLhandle loadProgramBinary(const std::filesystem::path& path, const ProgramBinaryHeader& expected)
+{
+    auto file = std::ifstream(path, std::ios_base::binary);
+    if (!file)
+        return {};
+
+    // Read the entry and make sure that it matches the requested program
+    ProgramBinaryHeader header;
+    std::vector<char>   binary;
+    bool valid = file.read(reinterpret_cast<char*>(&header), sizeof(header)) && (header.magic == expected.magic) &&
+                 (header.sourceHash == expected.sourceHash) && (header.driverHash == expected.driverHash);
+
+    // Don't trust the length stored in the header before checking it against the size of the file
+    std::error_code      error;
+    const std::uintmax_t fileSize = std::filesystem::file_size(path, error);
+    valid = valid && !error && (fileSize >= sizeof(header)) && (header.length == fileSize - sizeof(header));
+
+    if (valid)
+    {
+        binary.resize(header.length);
+        valid = static_cast<bool>(file.read(binary.data(), static_cast<std::streamsize>(binary.size())));
+    }
+    file.close();
 
-    std::vector<float> contiguous(vectorSize * length);
-    for (std::size_t i = 0; i < length; ++i)
+    // Let the driver restore the program, it may still reject the binary
+    GLEXT_GLhandle program{};
+    if (valid)
     {
-        contiguous[vectorSize * i]     = vectorArray[i].x;
-        contiguous[vectorSize * i + 1] = vectorArray[i].y;
-        contiguous[vectorSize * i + 2] = vectorArray[i].z;
+        program = glCheck(GLEXT_glCreateProgramObject());
+        glCheck(GLEXT_glProgramBinary(castFromGlHandle(program),
+                                      header.format,
+                                      binary.data(),
+                                      static_cast<GLsizei>(binary.size())));
+
+        GLint success = 0;
+        glCheck(GLEXT_glGetObjectParameteriv(program, GLEXT_GL_OBJECT_LINK_STATUS, &success));
+        if (success == GL_FALSE)
+        {
+            glCheck(GLEXT_glDeleteObject(program));
+            program = {};
+        }
     }
 
-    return contiguous;
+    if (!program)
+        std::filesystem::remove(path, error);
+
+    return program;
 }
 
-// Transforms an array of 4D vectors into a contiguous array of scalars
-std::vector<float> flatten(const sf::Glsl::Vec4* vectorArray, std::size_t length)
+// Store a linked program in the cache
+void saveProgramBinary(GLEXT_GLhandle program, const std::filesystem::path& path, ProgramBinaryHeader header)
 {
-    const std::size_t vectorSize = 4;
+    GLint length = 0;
+    glCheck(GLEXT_glGetProgramiv(castFromGlHandle(program), GLEXT_GL_PROGRAM_BINARY_LENGTH, &length));
+    if (length <= 0)
+        return;
 
-    std::vector<float> contiguous(vectorSize * length);
-    for (std::size_t i = 0; i < length; ++i)
+    std::vector<char> binary(static_cast<std::size_t>(length));
+    GLenum            format = 0;
+    glCheck(GLEXT_glGetProgramBinary(castFromGlHandle(program), length, &length, &format, binary.data()));
+    header.format = format;
+    header.length = static_cast<std::uint32_t>(length);
+
+    std::error_code error;
+    std::filesystem::create_directories(path.parent_path(), error);
+
+    // Write to a temporary file first, so that a partially written entry is never loaded; its name is unique
+    // so that threads and processes storing the same program at the same time don't write to the same file
+    static const std::uint32_t        processTag = std::random_device()();
+    static std::atomic<std::uint32_t> writeCount(0);
+    std::ostringstream                temporaryName;
+    temporaryName << '.' << std::hex << std::setfill('0') << std::setw(8) << processTag << std::setw(8) << writeCount++
+                  << ".tmp";
+    std::filesystem::path temporaryPath = path;
+    temporaryPath += temporaryName.str();
+
+    auto file = std::ofstream(temporaryPath, std::ios_base::binary | std::ios_base::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(binary.data(), length);
+    file.close();
+
+    if (file)
+        std::filesystem::rename(temporaryPath, path, error);
+
+    if (!file || error)
     {
-        contiguous[vectorSize * i]     = vectorArray[i].x;
-        contiguous[vectorSize * i + 1] = vectorArray[i].y;
-        contiguous[vectorSize * i + 2] = vectorArray[i].z;
-        contiguous[vectorSize * i + 3] = vectorArray[i].w;
+        sf::err() << "Failed to write shader binary cache entry\n" << sf::formatDebugPathInfo(path) << std::endl;
+        std::filesystem::remove(temporaryPath, error);
     }
+}
 
-    return contiguous;
+// Upload a single value to the currently bound program
+void uploadUniform(GLint location, float x)
+{
+    glCheck(GLEXT_glUniform1f(location, x));
+}
+
+void uploadUniform(GLint location, sf::Glsl::Vec2 v)
+{
+    glCheck(GLEXT_glUniform2f(location, v.x, v.y));
+}
+
+void uploadUniform(GLint location, const sf::Glsl::Vec3& v)
+{
+    glCheck(GLEXT_glUniform3f(location, v.x, v.y, v.z));
+}
+
+void uploadUniform(GLint location, const sf::Glsl::Vec4& v)
+{
+    glCheck(GLEXT_glUniform4f(location, v.x, v.y, v.z, v.w));
+}
+
+void uploadUniform(GLint location, int x)
+{
+    glCheck(GLEXT_glUniform1i(location, x));
+}
+
+void uploadUniform(GLint location, sf::Glsl::Ivec2 v)
+{
+    glCheck(GLEXT_glUniform2i(location, v.x, v.y));
+}
+
+void uploadUniform(GLint location, const sf::Glsl::Ivec3& v)
+{
+    glCheck(GLEXT_glUniform3i(location, v.x, v.y, v.z));
+}
+
+void uploadUniform(GLint location, const sf::Glsl::Ivec4& v)
+{
+    glCheck(GLEXT_glUniform4i(location, v.x, v.y, v.z, v.w));
+}
+
+void uploadUniform(GLint location, const sf::Glsl::Mat3& matrix)
+{
+    glCheck(GLEXT_glUniformMatrix3fv(location, 1, GL_FALSE, matrix.array.data()));
+}
+
+void uploadUniform(GLint location, const sf::Glsl::Mat4& matrix)
+{
+    glCheck(GLEXT_glUniformMatrix4fv(location, 1, GL_FALSE, matrix.array.data()));
 }
 } // namespace
 
@@ -311,9 +516,13 @@ Shader::~Shader()
 ////////////////////////////////////////////////////////////
 Shader::Shader(Shader&& source) noexcept :
 m_shaderProgram(std::exchange(source.m_shaderProgram, 0u)),
+m_programId(std::exchange(source.m_programId, 0u)),
 m_currentTexture(std::exchange(source.m_currentTexture, -1)),
 m_textures(std::move(source.m_textures)),
-m_uniforms(std::move(source.m_uniforms))
+m_uniforms(std::move(source.m_uniforms)),
+m_uniformBlocks(std::move(source.m_uniformBlocks)),
+m_deferredUniforms(std::move(source.m_deferredUniforms)),
+m_pendingUniforms(std::move(source.m_pendingUniforms))
 {
 }
 
@@ -334,10 +543,14 @@ Shader& Shader::operator=(Shader&& right) noexcept
     }
 
     // Move the contents of right.
-    m_shaderProgram  = std::exchange(right.m_shaderProgram, 0u);
-    m_currentTexture = std::exchange(right.m_currentTexture, -1);
-    m_textures       = std::move(right.m_textures);
-    m_uniforms       = std::move(right.m_uniforms);
+    m_shaderProgram    = std::exchange(right.m_shaderProgram, 0u);
+    m_programId        = std::exchange(right.m_programId, 0u);
+    m_currentTexture   = std::exchange(right.m_currentTexture, -1);
+    m_textures         = std::move(right.m_textures);
+    m_uniforms         = std::move(right.m_uniforms);
+    m_uniformBlocks    = std::move(right.m_uniformBlocks);
+    m_deferredUniforms = std::move(right.m_deferredUniforms);
+    m_pendingUniforms  = std::move(right.m_pendingUniforms);
     return *this;
 }
 
@@ -658,27 +871,10 @@ void Shader::setUniform(const std::string& name, const Texture& texture)
 
     // Find the location of the variable in the shader
     const int location = getUniformLocation(name);
-    if (location != -1)
+    if (location != -1 && !setTextureUniform(location, texture))
     {
-        // Store the location -> texture mapping
-        const auto it = m_textures.find(location);
-        if (it == m_textures.end())
-        {
-            // New entry, make sure there are enough texture units
-            if (m_textures.size() + 1 >= getMaxTextureUnits())
-            {
-                err() << "Impossible to use texture " << std::quoted(name)
-                      << " for shader: all available texture units are used" << std::endl;
-                return;
-            }
-
-            m_textures[location] = &texture;
-        }
-        else
-        {
-            // Location already used, just replace the texture
-            it->second = &texture;
-        }
+        err() << "Impossible to use texture " << std::quoted(name)
+              << " for shader: all available texture units are used" << std::endl;
     }
 }
 
@@ -696,6 +892,51 @@ void Shader::setUniform(const std::string& name, CurrentTextureType)
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::setUniformBlock(const std::string& name, const UniformBuffer& buffer)
+{
+    if (!m_shaderProgram)
+        return;
+
+    if (!UniformBuffer::isAvailable())
+    {
+        err() << "Impossible to use uniform block " << std::quoted(name)
+              << " for shader: your system doesn't support uniform buffers" << std::endl;
+        return;
+    }
+
+    const TransientContextLock lock;
+
+    // Find the index of the block in the shader
+    const GLuint index = glCheck(GLEXT_glGetUniformBlockIndex(m_shaderProgram, name.c_str()));
+    if (index == GLEXT_GL_INVALID_INDEX)
+    {
+        err() << "Uniform block " << std::quoted(name) << " not found in shader" << std::endl;
+        return;
+    }
+
+    // Store the index -> buffer mapping
+    const auto it = m_uniformBlocks.find(index);
+    if (it == m_uniformBlocks.end())
+    {
+        // New entry, make sure there are enough binding points
+        if (m_uniformBlocks.size() >= getMaxUniformBufferBindings())
+        {
+            err() << "Impossible to use uniform block " << std::quoted(name)
+                  << " for shader: all available binding points are used" << std::endl;
+            return;
+        }
+
+        m_uniformBlocks[index] = &buffer;
+    }
+    else
+    {
+        // Block already assigned, just replace the buffer
+        it->second = &buffer;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const float* scalarArray, std::size_t length)
 {
@@ -708,63 +949,205 @@ void Shader::setUniformArray(const std::string& name, const float* scalarArray,
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Vec2* vectorArray, std::size_t length)
 {
-    std::vector<float> contiguous = flatten(vectorArray, length);
-
     const UniformBinder binder(*this, name);
     if (binder.location != -1)
-        glCheck(GLEXT_glUniform2fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+        glCheck(GLEXT_glUniform2fv(binder.location, static_cast<GLsizei>(length), asScalarArray<2>(vectorArray)));
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Vec3* vectorArray, std::size_t length)
 {
-    std::vector<float> contiguous = flatten(vectorArray, length);
-
     const UniformBinder binder(*this, name);
     if (binder.location != -1)
-        glCheck(GLEXT_glUniform3fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+        glCheck(GLEXT_glUniform3fv(binder.location, static_cast<GLsizei>(length), asScalarArray<3>(vectorArray)));
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Vec4* vectorArray, std::size_t length)
 {
-    std::vector<float> contiguous = flatten(vectorArray, length);
-
     const UniformBinder binder(*this, name);
     if (binder.location != -1)
-        glCheck(GLEXT_glUniform4fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+        glCheck(GLEXT_glUniform4fv(binder.location, static_cast<GLsizei>(length), asScalarArray<4>(vectorArray)));
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Mat3* matrixArray, std::size_t length)
 {
-    static const std::size_t matrixSize = matrixArray[0].array.size();
+    const UniformBinder binder(*this, name);
+    if (binder.location != -1)
+    {
+        glCheck(GLEXT_glUniformMatrix3fv(binder.location,
+                                         static_cast<GLsizei>(length),
+                                         GL_FALSE,
+                                         asScalarArray<9>(matrixArray)));
+    }
+}
 
-    std::vector<float> contiguous(matrixSize * length);
-    for (std::size_t i = 0; i < length; ++i)
-        priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &contiguous[matrixSize * i]);
 
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(const std::string& name, const Glsl::Mat4* matrixArray, std::size_t length)
+{
     const UniformBinder binder(*this, name);
     if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix3fv(binder.location, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+    {
+        glCheck(GLEXT_glUniformMatrix4fv(binder.location,
+                                         static_cast<GLsizei>(length),
+                                         GL_FALSE,
+                                         asScalarArray<16>(matrixArray)));
+    }
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::setUniformArray(const std::string& name, const Glsl::Mat4* matrixArray, std::size_t length)
+Shader::UniformHandle Shader::getUniformHandle(const std::string& name)
 {
-    static const std::size_t matrixSize = matrixArray[0].array.size();
+    UniformHandle handle;
 
-    std::vector<float> contiguous(matrixSize * length);
-    for (std::size_t i = 0; i < length; ++i)
-        priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &contiguous[matrixSize * i]);
+    if (!m_shaderProgram)
+        return handle;
 
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix4fv(binder.location, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+    const TransientContextLock lock;
+
+    handle.m_location = getUniformLocation(name);
+    if (handle.m_location == -1)
+        return handle;
+
+    handle.m_programId = m_programId;
+
+    // Share the value slot of any handle previously created for this uniform
+    const auto it = std::find_if(m_deferredUniforms.begin(),
+                                 m_deferredUniforms.end(),
+                                 [&](const DeferredUniform& slot) { return slot.location == handle.m_location; });
+    handle.m_index = static_cast<std::size_t>(it - m_deferredUniforms.begin());
+
+    if (it == m_deferredUniforms.end())
+        m_deferredUniforms.push_back({handle.m_location, {}, false});
+
+    return handle;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, float x)
+{
+    setDeferredUniform(handle, x);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, Glsl::Vec2 v)
+{
+    setDeferredUniform(handle, v);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Vec3& v)
+{
+    setDeferredUniform(handle, v);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Vec4& v)
+{
+    setDeferredUniform(handle, v);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, int x)
+{
+    setDeferredUniform(handle, x);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, Glsl::Ivec2 v)
+{
+    setDeferredUniform(handle, v);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Ivec3& v)
+{
+    setDeferredUniform(handle, v);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Ivec4& v)
+{
+    setDeferredUniform(handle, v);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, bool x)
+{
+    setUniform(handle, static_cast<int>(x));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, Glsl::Bvec2 v)
+{
+    setUniform(handle, Glsl::Ivec2(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Bvec3& v)
+{
+    setUniform(handle, Glsl::Ivec3(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Bvec4& v)
+{
+    setUniform(handle, Glsl::Ivec4(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Mat3& matrix)
+{
+    setDeferredUniform(handle, matrix);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Mat4& matrix)
+{
+    setDeferredUniform(handle, matrix);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Texture& texture)
+{
+    if (!m_shaderProgram || !handle.isValid())
+        return;
+
+    const TransientContextLock lock;
+
+    if (!setTextureUniform(handle.m_location, texture))
+        err() << "Impossible to use texture for shader: all available texture units are used" << std::endl;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, CurrentTextureType)
+{
+    if (!m_shaderProgram || !handle.isValid())
+        return;
+
+    m_currentTexture = handle.m_location;
 }
 
 
@@ -793,9 +1176,15 @@ void Shader::bind(const Shader* shader)
         // Enable the program
         glCheck(GLEXT_glUseProgramObject(castToGlHandle(shader->m_shaderProgram)));
 
+        // Upload the values set through uniform handles
+        shader->applyDeferredUniforms();
+
         // Bind the textures
         shader->bindTextures();
 
+        // Bind the uniform buffers
+        shader->bindUniformBlocks();
+
         // Bind the current texture
         if (shader->m_currentTexture != -1)
             glCheck(GLEXT_glUniform1i(shader->m_currentTexture, 0));
@@ -843,6 +1232,38 @@ bool Shader::isGeometryAvailable()
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::setBinaryCacheDirectory(const std::filesystem::path& directory)
+{
+    BinaryCacheDirectory& cacheDirectory = getBinaryCacheDirectory();
+    const std::lock_guard lock(cacheDirectory.mutex);
+    cacheDirectory.path = directory;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isBinaryCacheAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        if (!isAvailable() || !GLEXT_get_program_binary)
+            return false;
+
+        // Some drivers expose the extension without supporting any binary format
+        GLint formatCount = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount));
+        return formatCount > 0;
+    }();
+
+    return available;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometryShaderCode, std::string_view fragmentShaderCode)
 {
@@ -864,6 +1285,51 @@ bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometr
         return false;
     }
 
+    // Helper function to replace the current program with a newly linked one
+    const auto replaceProgram = [this](GLEXT_GLhandle program)
+    {
+        // Destroy the shader if it was already created
+        if (m_shaderProgram)
+            glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
+
+        // Reset the internal state
+        m_currentTexture = -1;
+        m_textures.clear();
+        m_uniforms.clear();
+        m_uniformBlocks.clear();
+        m_deferredUniforms.clear();
+        m_pendingUniforms.clear();
+
+        m_shaderProgram = castFromGlHandle(program);
+        m_programId     = getUniqueProgramId();
+
+        // Force an OpenGL flush, so that the shader will appear updated
+        // in all contexts immediately (solves problems in multi-threaded apps)
+        glCheck(glFlush());
+    };
+
+    // Restore the program from the binary cache if it was linked by a previous run
+    ProgramBinaryHeader   binaryHeader;
+    std::filesystem::path binaryPath;
+    if (isBinaryCacheAvailable())
+    {
+        BinaryCacheDirectory& directory = getBinaryCacheDirectory();
+        const std::lock_guard directoryLock(directory.mutex);
+        binaryPath = directory.path;
+    }
+
+    if (!binaryPath.empty())
+    {
+        binaryHeader = makeProgramBinaryHeader(vertexShaderCode, geometryShaderCode, fragmentShaderCode);
+        binaryPath /= getProgramBinaryFileName(binaryHeader);
+
+        if (const GLEXT_GLhandle cachedProgram = loadProgramBinary(binaryPath, binaryHeader))
+        {
+            replaceProgram(cachedProgram);
+            return true;
+        }
+    }
+
     // Create the program
     const GLEXT_GLhandle shaderProgram = glCheck(GLEXT_glCreateProgramObject());
 
@@ -912,6 +1378,14 @@ bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometr
         if (!createAndAttachShader(GLEXT_GL_FRAGMENT_SHADER, "fragment", fragmentShaderCode))
             return false;
 
+    // Allow the linked program to be retrieved for the binary cache
+    if (!binaryPath.empty())
+    {
+        glCheck(GLEXT_glProgramParameteri(castFromGlHandle(shaderProgram),
+                                          GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                                          GL_TRUE));
+    }
+
     // Link the program
     glCheck(GLEXT_glLinkProgram(shaderProgram));
 
@@ -927,24 +1401,11 @@ bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometr
         return false;
     }
 
-    // Destroy the shader if it was already created
-    if (m_shaderProgram)
-    {
-        glCheck(GLEXT_glDeleteObject(castToGlHandle(m_shaderProgram)));
-        m_shaderProgram = 0;
-    }
-
-    // Reset the internal state
-    m_currentTexture = -1;
-    m_textures.clear();
-    m_uniforms.clear();
-
-    m_shaderProgram = castFromGlHandle(shaderProgram);
-
-    // Force an OpenGL flush, so that the shader will appear updated
-    // in all contexts immediately (solves problems in multi-threaded apps)
-    glCheck(glFlush());
+    // Store the program in the binary cache for the next runs
+    if (!binaryPath.empty())
+        saveProgramBinary(shaderProgram, binaryPath, binaryHeader);
 
+    replaceProgram(shaderProgram);
     return true;
 }
 
@@ -967,6 +1428,19 @@ void Shader::bindTextures() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::bindUniformBlocks() const
+{
+    GLuint binding = 0;
+    for (const auto& [index, buffer] : m_uniformBlocks)
+    {
+        glCheck(GLEXT_glUniformBlockBinding(m_shaderProgram, index, binding));
+        glCheck(GLEXT_glBindBufferBase(GLEXT_GL_UNIFORM_BUFFER, binding, buffer->getNativeHandle()));
+        ++binding;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 int Shader::getUniformLocation(const std::string& name)
 {
@@ -987,6 +1461,61 @@ int Shader::getUniformLocation(const std::string& name)
     return location;
 }
 
+
+////////////////////////////////////////////////////////////
+bool Shader::setTextureUniform(int location, const Texture& texture)
+{
+    // Store the location -> texture mapping
+    const auto it = m_textures.find(location);
+    if (it == m_textures.end())
+    {
+        // New entry, make sure there are enough texture units
+        if (m_textures.size() + 1 >= getMaxTextureUnits())
+            return false;
+
+        m_textures[location] = &texture;
+    }
+    else
+    {
+        // Location already used, just replace the texture
+        it->second = &texture;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setDeferredUniform(UniformHandle handle, const UniformValue& value)
+{
+    // Ignore invalid handles, and handles that were created for another program (before the shader was reloaded)
+    if (!handle.isValid() || (handle.m_programId != m_programId))
+        return;
+
+    DeferredUniform& slot = m_deferredUniforms[handle.m_index];
+
+    slot.value = value;
+    if (!slot.pending)
+    {
+        slot.pending = true;
+        m_pendingUniforms.push_back(handle.m_index);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::applyDeferredUniforms() const
+{
+    for (const std::size_t index : m_pendingUniforms)
+    {
+        DeferredUniform& slot = m_deferredUniforms[index];
+        std::visit([location = slot.location](const auto& value) { uploadUniform(location, value); }, slot.value);
+        slot.pending = false;
+    }
+
+    m_pendingUniforms.clear();
+}
+
 } // namespace sf
 
 #else // SFML_OPENGL_ES
@@ -1241,6 +1770,12 @@ void Shader::setUniform(const std::string& /* name */, CurrentTextureType)
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::setUniformBlock(const std::string& /* name */, const UniformBuffer& /* buffer */)
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& /* name */, const float* /* scalarArray */, std::size_t /* length */)
 {
@@ -1277,6 +1812,109 @@ void Shader::setUniformArray(const std::string& /* name */, const Glsl::Mat4* /*
 }
 
 
+////////////////////////////////////////////////////////////
+Shader::UniformHandle Shader::getUniformHandle(const std::string& /* name */)
+{
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, float)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, Glsl::Vec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Vec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Vec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, int)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, Glsl::Ivec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Ivec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Ivec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, bool)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, Glsl::Bvec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Bvec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Bvec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Mat3& /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Mat4& /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Texture& /* texture */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, CurrentTextureType)
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int Shader::getNativeHandle() const
 {
@@ -1304,6 +1942,19 @@ bool Shader::isGeometryAvailable()
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::setBinaryCacheDirectory(const std::filesystem::path& /* directory */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isBinaryCacheAvailable()
+{
+    return false;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Shader::compile(std::string_view /* vertexShaderCode */,
                      std::string_view /* geometryShaderCode */,
@@ -1318,6 +1969,18 @@ void Shader::bindTextures() const
 {
 }
 
+
+////////////////////////////////////////////////////////////
+void Shader::bindUniformBlocks() const
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::applyDeferredUniforms() const
+{
+}
+
 } // namespace sf
 
 #endif // SFML_OPENGL_ES
@@ -0,0 +1,271 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/SpriteBatch.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace SpriteBatchImpl
+{
+// Each instance is rendered as two independent triangles
+constexpr std::size_t verticesPerInstance = 6;
+} // namespace SpriteBatchImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SpriteBatch::SpriteBatch(const Texture& texture) :
+m_texture(&texture),
+m_vertexBuffer(PrimitiveType::Triangles, VertexBuffer::Usage::Dynamic)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setTexture(const Texture& texture)
+{
+    m_texture = &texture;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& SpriteBatch::getTexture() const
+{
+    return *m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::append(const Instance& instance)
+{
+    const std::size_t index = m_instances.size();
+
+    resize(index + 1);
+    setInstance(index, instance);
+
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setInstance(std::size_t index, const Instance& instance)
+{
+    assert(index < m_instances.size() && "Index is out of bounds");
+
+    m_instances[index] = instance;
+    updateVertices(index);
+
+    // Extend the range of instances that must be transferred to graphics memory
+    if (m_dirtyBegin == m_dirtyEnd)
+    {
+        m_dirtyBegin = index;
+        m_dirtyEnd   = index + 1;
+    }
+    else
+    {
+        m_dirtyBegin = std::min(m_dirtyBegin, index);
+        m_dirtyEnd   = std::max(m_dirtyEnd, index + 1);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+const SpriteBatch::Instance& SpriteBatch::getInstance(std::size_t index) const
+{
+    assert(index < m_instances.size() && "Index is out of bounds");
+    return m_instances[index];
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::getInstanceCount() const
+{
+    return m_instances.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::resize(std::size_t instanceCount)
+{
+    const std::size_t previousCount = m_instances.size();
+
+    m_instances.resize(instanceCount);
+    m_vertices.resize(instanceCount * SpriteBatchImpl::verticesPerInstance);
+
+    // New instances must be transferred to graphics memory
+    if (instanceCount > previousCount)
+    {
+        for (std::size_t i = previousCount; i < instanceCount; ++i)
+            updateVertices(i);
+
+        m_dirtyBegin = (m_dirtyBegin == m_dirtyEnd) ? previousCount : std::min(m_dirtyBegin, previousCount);
+        m_dirtyEnd   = instanceCount;
+    }
+    else
+    {
+        m_dirtyBegin = std::min(m_dirtyBegin, instanceCount);
+        m_dirtyEnd   = std::min(m_dirtyEnd, instanceCount);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::clear()
+{
+    resize(0);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setVertexBufferEnabled(bool enabled)
+{
+    m_isVertexBufferEnabled = enabled;
+
+    // Release the graphics memory, the whole batch is transferred again if it is enabled later
+    if (!enabled)
+        m_vertexBuffer = VertexBuffer(PrimitiveType::Triangles, VertexBuffer::Usage::Dynamic);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SpriteBatch::isVertexBufferEnabled() const
+{
+    return m_isVertexBufferEnabled;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect SpriteBatch::getLocalBounds() const
+{
+    if (m_vertices.empty())
+        return {};
+
+    Vector2f min = m_vertices[0].position;
+    Vector2f max = m_vertices[0].position;
+
+    for (const Vertex& vertex : m_vertices)
+    {
+        min.x = std::min(min.x, vertex.position.x);
+        min.y = std::min(min.y, vertex.position.y);
+        max.x = std::max(max.x, vertex.position.x);
+        max.y = std::max(max.y, vertex.position.y);
+    }
+
+    return {min, max - min};
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect SpriteBatch::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_instances.empty())
+        return;
+
+    states.transform *= getTransform();
+    states.texture        = m_texture;
+    states.coordinateType = CoordinateType::Pixels;
+
+    // Render from graphics memory if possible, fall back to system memory otherwise
+    if (m_isVertexBufferEnabled && VertexBuffer::isAvailable() && ensureBufferUpdate())
+        target.draw(m_vertexBuffer, 0, m_vertices.size(), states);
+    else
+        target.draw(m_vertices.data(), m_vertices.size(), PrimitiveType::Triangles, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::updateVertices(std::size_t index)
+{
+    const Instance& instance    = m_instances[index];
+    const auto [position, size] = FloatRect(instance.textureRect);
+
+    // Absolute value is used to support negative texture rect sizes, like sf::Sprite
+    const Vector2f absSize(std::abs(size.x), std::abs(size.y));
+
+    const std::array<Vertex, 4> corners = {
+        Vertex{instance.transform.transformPoint({0.f, 0.f}), instance.color, position},
+        Vertex{instance.transform.transformPoint({0.f, absSize.y}), instance.color, position + Vector2f(0.f, size.y)},
+        Vertex{instance.transform.transformPoint({absSize.x, 0.f}), instance.color, position + Vector2f(size.x, 0.f)},
+        Vertex{instance.transform.transformPoint(absSize), instance.color, position + size}};
+
+    Vertex* vertices = &m_vertices[index * SpriteBatchImpl::verticesPerInstance];
+    vertices[0]      = corners[0];
+    vertices[1]      = corners[1];
+    vertices[2]      = corners[2];
+    vertices[3]      = corners[2];
+    vertices[4]      = corners[1];
+    vertices[5]      = corners[3];
+}
+
+
+////////////////////////////////////////////////////////////
+bool SpriteBatch::ensureBufferUpdate() const
+{
+    // Reallocate the buffer if it is too small, keeping some room to grow
+    if (m_vertexBuffer.getVertexCount() < m_vertices.size())
+    {
+        if (!m_vertexBuffer.create(m_vertices.capacity()))
+            return false;
+
+        m_dirtyBegin = 0;
+        m_dirtyEnd   = m_instances.size();
+    }
+
+    if (m_dirtyBegin != m_dirtyEnd)
+    {
+        const std::size_t first = m_dirtyBegin * SpriteBatchImpl::verticesPerInstance;
+        const std::size_t count = (m_dirtyEnd - m_dirtyBegin) * SpriteBatchImpl::verticesPerInstance;
+
+        if (!m_vertexBuffer.update(m_vertices.data() + first, count, static_cast<unsigned int>(first)))
+            return false;
+
+        m_dirtyBegin = m_dirtyEnd = 0;
+    }
+
+    return true;
+}
+
+} // namespace sf
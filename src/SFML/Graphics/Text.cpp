@@ -27,11 +27,20 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include <SFML/System/Err.hpp>
+
 #include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include <cmath>
 #include <cstddef>
@@ -40,14 +49,66 @@
 
 namespace
 {
+// Fragment shader reconstructing the edges of distance field glyphs, antialiased over a screen pixel;
+// the outline is drawn by lowering the threshold below the edge value of 0.5
+constexpr std::string_view distanceFieldShader = R"(
+uniform sampler2D texture;
+uniform float threshold;
+
+void main()
+{
+    float distance  = texture2D(texture, gl_TexCoord[0].xy).a;
+    float smoothing = 0.7 * fwidth(distance);
+    float alpha     = smoothstep(threshold - smoothing, threshold + smoothing, distance);
+    gl_FragColor    = vec4(gl_Color.rgb, gl_Color.a * alpha);
+}
+)";
+
+// Number of vertices addressed by 16-bit indices, longer texts are drawn in several chunks of this size
+constexpr std::size_t chunkVertexCount = 65536;
+
+// Add the indices of the two triangles of the quad made of the last 4 vertices of the vertex array,
+// relative to the first vertex of its chunk (quads never span two chunks as they are made of 4 vertices)
+void addQuadIndices(std::vector<std::uint16_t>& indices, const sf::VertexArray& vertices)
+{
+    const auto first = static_cast<std::uint16_t>((vertices.getVertexCount() - 4) % chunkVertexCount);
+
+    indices.insert(indices.end(),
+                   {first,
+                    static_cast<std::uint16_t>(first + 1),
+                    static_cast<std::uint16_t>(first + 2),
+                    static_cast<std::uint16_t>(first + 2),
+                    static_cast<std::uint16_t>(first + 1),
+                    static_cast<std::uint16_t>(first + 3)});
+}
+
+// Draw quads built by `addQuadIndices`, one chunk of vertices at a time
+void drawQuads(sf::RenderTarget&                 target,
+               const sf::VertexArray&            vertices,
+               const std::vector<std::uint16_t>& indices,
+               const sf::RenderStates&           states)
+{
+    for (std::size_t first = 0; first < vertices.getVertexCount(); first += chunkVertexCount)
+    {
+        const std::size_t vertexCount = std::min(chunkVertexCount, vertices.getVertexCount() - first);
+        target.draw(&vertices[first],
+                    vertexCount,
+                    indices.data() + first / 4 * 6,
+                    vertexCount / 4 * 6,
+                    sf::PrimitiveType::Triangles,
+                    states);
+    }
+}
+
 // Add an underline or strikethrough line to the vertex array
-void addLine(sf::VertexArray& vertices,
-             float            lineLength,
-             float            lineTop,
-             sf::Color        color,
-             float            offset,
-             float            thickness,
-             float            outlineThickness = 0)
+void addLine(sf::VertexArray&            vertices,
+             std::vector<std::uint16_t>& indices,
+             float                       lineLength,
+             float                       lineTop,
+             sf::Color                   color,
+             float                       offset,
+             float                       thickness,
+             float                       outlineThickness = 0)
 {
     const float top    = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
     const float bottom = top + std::floor(thickness + 0.5f);
@@ -55,34 +116,81 @@ void addLine(sf::VertexArray& vertices,
     vertices.append({{-outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}});
     vertices.append({{lineLength + outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}});
     vertices.append({{-outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}});
-    vertices.append({{-outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}});
-    vertices.append({{lineLength + outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}});
     vertices.append({{lineLength + outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}});
+
+    addQuadIndices(indices, vertices);
 }
 
 // Add a glyph quad to the vertex array
-void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, sf::Color color, const sf::Glyph& glyph, float italicShear)
+void addGlyphQuad(sf::VertexArray&            vertices,
+                  std::vector<std::uint16_t>& indices,
+                  sf::Vector2f                position,
+                  sf::Color                   color,
+                  const sf::Glyph&            glyph,
+                  float                       italicShear,
+                  float                       padding        = 1.f,
+                  float                       texturePadding = 1.f)
 {
-    const sf::Vector2f padding(1.f, 1.f);
-
-    const sf::Vector2f p1 = glyph.bounds.position - padding;
-    const sf::Vector2f p2 = glyph.bounds.position + glyph.bounds.size + padding;
+    const sf::Vector2f p1 = glyph.bounds.position - sf::Vector2f(padding, padding);
+    const sf::Vector2f p2 = glyph.bounds.position + glyph.bounds.size + sf::Vector2f(padding, padding);
 
-    const auto uv1 = sf::Vector2f(glyph.textureRect.position) - padding;
-    const auto uv2 = sf::Vector2f(glyph.textureRect.position + glyph.textureRect.size) + padding;
+    const auto uv1 = sf::Vector2f(glyph.textureRect.position) - sf::Vector2f(texturePadding, texturePadding);
+    const auto uv2 = sf::Vector2f(glyph.textureRect.position + glyph.textureRect.size) +
+                     sf::Vector2f(texturePadding, texturePadding);
 
     vertices.append({position + sf::Vector2f(p1.x - italicShear * p1.y, p1.y), color, {uv1.x, uv1.y}});
     vertices.append({position + sf::Vector2f(p2.x - italicShear * p1.y, p1.y), color, {uv2.x, uv1.y}});
     vertices.append({position + sf::Vector2f(p1.x - italicShear * p2.y, p2.y), color, {uv1.x, uv2.y}});
-    vertices.append({position + sf::Vector2f(p1.x - italicShear * p2.y, p2.y), color, {uv1.x, uv2.y}});
-    vertices.append({position + sf::Vector2f(p2.x - italicShear * p1.y, p1.y), color, {uv2.x, uv1.y}});
     vertices.append({position + sf::Vector2f(p2.x - italicShear * p2.y, p2.y), color, {uv2.x, uv2.y}});
+
+    addQuadIndices(indices, vertices);
 }
 } // namespace
 
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+struct Text::DistanceFieldShaders
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shader drawing the glyphs up to a threshold
+    ///
+    /// Each threshold has its own shader, so that its uniform never
+    /// changes while batched draws using it are pending. Thresholds
+    /// are rounded to the 8-bit precision of the field, which bounds
+    /// the number of shaders created for animated outlines.
+    ///
+    /// \param threshold Value of the field at which the glyphs end, in [0, 1]
+    ///
+    /// \return Pointer to the shader, or a null pointer if it failed to compile
+    ///
+    ////////////////////////////////////////////////////////////
+    const Shader* getOutline(float threshold)
+    {
+        const auto step = static_cast<int>(std::lround(std::clamp(threshold, 0.f, 1.f) * 255.f));
+
+        const std::lock_guard lock(mutex);
+
+        if (const auto it = outlines.find(step); it != outlines.end())
+            return &it->second;
+
+        Shader shader;
+        if (!shader.loadFromMemory(distanceFieldShader, Shader::Type::Fragment))
+            return nullptr;
+
+        shader.setUniform("texture", Shader::CurrentTexture);
+        shader.setUniform("threshold", static_cast<float>(step) / 255.f);
+
+        return &outlines.emplace(step, std::move(shader)).first->second;
+    }
+
+    Shader                fill;     //!< Shader drawing the glyphs up to their edges
+    std::map<int, Shader> outlines; //!< Shaders drawing the glyphs beyond their edges, by rounded threshold
+    std::mutex            mutex;    //!< Mutex protecting the outline shaders, which are shared by all the texts
+};
+
+
 ////////////////////////////////////////////////////////////
 Text::Text(const Font& font, String string, unsigned int characterSize) :
 m_string(std::move(string)),
@@ -97,8 +205,15 @@ void Text::setString(const String& string)
 {
     if (m_string != string)
     {
-        m_string             = string;
-        m_geometryNeedUpdate = true;
+        // Characters appended to the string are laid out after the existing ones,
+        // any other change requires laying out the whole string again
+        const bool appended = (string.getSize() > m_string.getSize()) &&
+                              std::equal(m_string.begin(), m_string.end(), string.begin());
+
+        m_string = string;
+
+        if (!appended)
+            m_geometryNeedUpdate = true;
     }
 }
 
@@ -341,31 +456,132 @@ void Text::draw(RenderTarget& target, RenderStates states) const
     states.texture        = &m_font->getTexture(m_characterSize);
     states.coordinateType = CoordinateType::Pixels;
 
+    // Distance field glyphs need a shader to reconstruct their edges, unless one is provided
+    DistanceFieldShaders* shaders = nullptr;
+    if (m_font->isDistanceFieldEnabled() && !states.shader)
+    {
+        if (!m_distanceFieldShaders)
+            m_distanceFieldShaders = getDistanceFieldShaders();
+
+        shaders = m_distanceFieldShaders.get();
+    }
+
     // Only draw the outline if there is something to draw
-    if (m_outlineThickness != 0)
-        target.draw(m_outlineVertices, states);
+    if ((m_outlineThickness != 0) && !m_outlineIndices.empty())
+    {
+        RenderStates outlineStates = states;
 
-    target.draw(m_vertices, states);
+        if (shaders)
+        {
+            // Convert the outline thickness to a distance in the field, which is mapped to [0, 1]
+            const float scale     = static_cast<float>(Font::DistanceFieldCharacterSize) /
+                                static_cast<float>(std::max(m_characterSize, 1u));
+            const float threshold = 0.5f - m_outlineThickness * scale / (2.f * float{Font::DistanceFieldSpread});
+
+            // Without its shader the outline is drawn unprocessed, like when the fill shader is missing
+            outlineStates.shader = shaders->getOutline(threshold);
+        }
+
+        drawQuads(target, m_outlineVertices, m_outlineIndices, outlineStates);
+    }
+
+    if (shaders)
+        states.shader = &shaders->fill;
+
+    drawQuads(target, m_vertices, m_indices, states);
+}
+
+
+////////////////////////////////////////////////////////////
+std::shared_ptr<Text::DistanceFieldShaders> Text::getDistanceFieldShaders()
+{
+    // The shaders are released when the last text using them is destroyed
+    static std::mutex                          mutex;
+    static std::weak_ptr<DistanceFieldShaders> cachedShaders;
+    static bool                                failed = false;
+
+    const std::lock_guard lock(mutex);
+
+    if (auto shaders = cachedShaders.lock())
+        return shaders;
+
+    // Don't try again on every draw if shaders can't be compiled
+    if (failed)
+        return nullptr;
+
+    auto shaders = std::make_shared<DistanceFieldShaders>();
+    if (!Shader::isAvailable() || !shaders->fill.loadFromMemory(distanceFieldShader, Shader::Type::Fragment))
+    {
+        err() << "Failed to create the shaders for distance field text, glyphs will be drawn unprocessed"
+              << std::endl;
+        failed = true;
+        return nullptr;
+    }
+
+    shaders->fill.setUniform("texture", Shader::CurrentTexture);
+    shaders->fill.setUniform("threshold", 0.5f);
+
+    cachedShaders = shaders;
+    return shaders;
 }
 
 
 ////////////////////////////////////////////////////////////
 void Text::ensureGeometryUpdate() const
 {
-    // Do nothing, if geometry has not changed and the font texture has not changed
-    if (!m_geometryNeedUpdate && m_font->getTexture(m_characterSize).m_cacheId == m_fontTextureId)
-        return;
+    // Pin the glyphs while laying out: those loaded first are moved but kept when a later one evicts glyphs
+    m_font->pinGlyphs(m_characterSize);
 
-    // Save the current fonts texture id
-    m_fontTextureId = m_font->getTexture(m_characterSize).m_cacheId;
+    // Lay out again until no glyph was evicted or moved meanwhile; the glyphs are all
+    // in the texture after the first layout, so the second one never changes it
+    updateGeometry();
+    while (m_fontLayoutId != m_font->getTexture(m_characterSize).m_layoutId)
+        updateGeometry();
 
-    // Mark geometry as updated
-    m_geometryNeedUpdate = false;
+    m_font->unpinGlyphs(m_characterSize);
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::updateGeometry() const
+{
+    // Glyphs added to the font texture don't affect the ones already laid out, only moving them does
+    const std::uint64_t fontLayoutId = m_font->getTexture(m_characterSize).m_layoutId;
 
-    // Clear the previous geometry
-    m_vertices.clear();
-    m_outlineVertices.clear();
-    m_bounds = FloatRect();
+    // Lay out the whole string if an attribute or the glyph positions changed, or if nothing was laid out yet
+    if (m_geometryNeedUpdate || (fontLayoutId != m_fontLayoutId) || (m_layout.characterCount == 0))
+    {
+        // Save the current layout of the font texture
+        m_fontLayoutId = fontLayoutId;
+
+        // Mark geometry as updated
+        m_geometryNeedUpdate = false;
+
+        // Clear the previous geometry
+        m_vertices.clear();
+        m_outlineVertices.clear();
+        m_indices.clear();
+        m_outlineIndices.clear();
+        m_bounds = FloatRect();
+
+        // Start the layout from the first character
+        m_layout          = LayoutState();
+        m_layout.position = Vector2f(0.f, static_cast<float>(m_characterSize));
+        m_layout.minimum  = Vector2f(static_cast<float>(m_characterSize), static_cast<float>(m_characterSize));
+    }
+    else if (m_layout.characterCount < m_string.getSize())
+    {
+        // Characters were appended: remove the lines of the last row, they are added again after the new characters
+        m_vertices.resize(m_layout.vertexCount);
+        m_outlineVertices.resize(m_layout.outlineVertexCount);
+        m_indices.resize(m_layout.indexCount);
+        m_outlineIndices.resize(m_layout.outlineIndexCount);
+    }
+    else
+    {
+        // Do nothing, if geometry has not changed and the glyphs have not moved
+        return;
+    }
 
     // No text: nothing to draw
     if (m_string.isEmpty())
@@ -389,17 +605,29 @@ void Text::ensureGeometryUpdate() const
     const float letterSpacing   = (whitespaceWidth / 3.f) * (m_letterSpacingFactor - 1.f);
     whitespaceWidth += letterSpacing;
     const float lineSpacing = m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor;
-    float       x           = 0.f;
-    auto        y           = static_cast<float>(m_characterSize);
-
-    // Create one quad for each character
-    auto          minX     = static_cast<float>(m_characterSize);
-    auto          minY     = static_cast<float>(m_characterSize);
-    float         maxX     = 0.f;
-    float         maxY     = 0.f;
-    std::uint32_t prevChar = 0;
-    for (const std::uint32_t curChar : m_string)
+    float       x           = m_layout.position.x;
+    float       y           = m_layout.position.y;
+
+    // Distance field glyphs are drawn with their whole margin, which holds their outline
+    float glyphPadding   = 1.f;
+    float texturePadding = 1.f;
+    if (m_font->isDistanceFieldEnabled())
+    {
+        texturePadding = float{Font::DistanceFieldSpread};
+        glyphPadding   = texturePadding * static_cast<float>(m_characterSize) /
+                       static_cast<float>(Font::DistanceFieldCharacterSize);
+    }
+
+    // Create one quad for each character that is not laid out yet
+    float         minX     = m_layout.minimum.x;
+    float         minY     = m_layout.minimum.y;
+    float         maxX     = m_layout.maximum.x;
+    float         maxY     = m_layout.maximum.y;
+    std::uint32_t prevChar = m_layout.previousCharacter;
+    for (std::size_t i = m_layout.characterCount; i < m_string.getSize(); ++i)
     {
+        const std::uint32_t curChar = m_string[i];
+
         // Skip the \r char to avoid weird graphical issues
         if (curChar == U'\r')
             continue;
@@ -410,19 +638,33 @@ void Text::ensureGeometryUpdate() const
         // If we're using the underlined style and there's a new line, draw a line
         if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
         {
-            addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
+            addLine(m_vertices, m_indices, x, y, m_fillColor, underlineOffset, underlineThickness);
 
             if (m_outlineThickness != 0)
-                addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+                addLine(m_outlineVertices,
+                        m_outlineIndices,
+                        x,
+                        y,
+                        m_outlineColor,
+                        underlineOffset,
+                        underlineThickness,
+                        m_outlineThickness);
         }
 
         // If we're using the strike through style and there's a new line, draw a line across all characters
         if (isStrikeThrough && (curChar == U'\n' && prevChar != U'\n'))
         {
-            addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
+            addLine(m_vertices, m_indices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
 
             if (m_outlineThickness != 0)
-                addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+                addLine(m_outlineVertices,
+                        m_outlineIndices,
+                        x,
+                        y,
+                        m_outlineColor,
+                        strikeThroughOffset,
+                        underlineThickness,
+                        m_outlineThickness);
         }
 
         prevChar = curChar;
@@ -462,14 +704,28 @@ void Text::ensureGeometryUpdate() const
             const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold, m_outlineThickness);
 
             // Add the outline glyph to the vertices
-            addGlyphQuad(m_outlineVertices, Vector2f(x, y), m_outlineColor, glyph, italicShear);
+            addGlyphQuad(m_outlineVertices,
+                         m_outlineIndices,
+                         Vector2f(x, y),
+                         m_outlineColor,
+                         glyph,
+                         italicShear,
+                         glyphPadding,
+                         texturePadding);
         }
 
         // Extract the current glyph's description
         const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
 
         // Add the glyph to the vertices
-        addGlyphQuad(m_vertices, Vector2f(x, y), m_fillColor, glyph, italicShear);
+        addGlyphQuad(m_vertices,
+                     m_indices,
+                     Vector2f(x, y),
+                     m_fillColor,
+                     glyph,
+                     italicShear,
+                     glyphPadding,
+                     texturePadding);
 
         // Update the current bounds
         const Vector2f p1 = glyph.bounds.position;
@@ -484,6 +740,17 @@ void Text::ensureGeometryUpdate() const
         x += glyph.advance + letterSpacing;
     }
 
+    // Save the layout state, so that appended characters can resume from there
+    m_layout.characterCount     = m_string.getSize();
+    m_layout.position           = Vector2f(x, y);
+    m_layout.previousCharacter  = prevChar;
+    m_layout.minimum            = Vector2f(minX, minY);
+    m_layout.maximum            = Vector2f(maxX, maxY);
+    m_layout.vertexCount        = m_vertices.getVertexCount();
+    m_layout.outlineVertexCount = m_outlineVertices.getVertexCount();
+    m_layout.indexCount         = m_indices.size();
+    m_layout.outlineIndexCount  = m_outlineIndices.size();
+
     // If we're using outline, update the current bounds
     if (m_outlineThickness != 0)
     {
@@ -497,19 +764,33 @@ void Text::ensureGeometryUpdate() const
     // If we're using the underlined style, add the last line
     if (isUnderlined && (x > 0))
     {
-        addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
+        addLine(m_vertices, m_indices, x, y, m_fillColor, underlineOffset, underlineThickness);
 
         if (m_outlineThickness != 0)
-            addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+            addLine(m_outlineVertices,
+                    m_outlineIndices,
+                    x,
+                    y,
+                    m_outlineColor,
+                    underlineOffset,
+                    underlineThickness,
+                    m_outlineThickness);
     }
 
     // If we're using the strike through style, add the last line across all characters
     if (isStrikeThrough && (x > 0))
     {
-        addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
+        addLine(m_vertices, m_indices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
 
         if (m_outlineThickness != 0)
-            addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+            addLine(m_outlineVertices,
+                    m_outlineIndices,
+                    x,
+                    y,
+                    m_outlineColor,
+                    strikeThroughOffset,
+                    underlineThickness,
+                    m_outlineThickness);
     }
 
     // Update the bounding rectangle
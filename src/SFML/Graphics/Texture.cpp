@@ -28,7 +28,9 @@
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureContainer.hpp>
 #include <SFML/Graphics/TextureSaver.hpp>
 
 #include <SFML/Window/Context.hpp>
@@ -36,12 +38,18 @@
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Exception.hpp>
+#include <SFML/System/InputStream.hpp>
+#include <SFML/System/Utils.hpp>
 
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <fstream>
+#include <memory>
+#include <optional>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 #include <cassert>
 #include <cstring>
@@ -60,6 +68,89 @@ std::uint64_t getUniqueId() noexcept
 
     return id.fetch_add(1);
 }
+
+// Read the contents of a file into an array of bytes
+bool getFileContents(const std::filesystem::path& filename, std::vector<std::uint8_t>& buffer)
+{
+    if (auto file = std::ifstream(filename, std::ios_base::binary))
+    {
+        file.seekg(0, std::ios_base::end);
+        const std::ifstream::pos_type size = file.tellg();
+        if (size > 0)
+        {
+            file.seekg(0, std::ios_base::beg);
+            buffer.resize(static_cast<std::size_t>(size));
+            file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(size));
+        }
+        return true;
+    }
+
+    return false;
+}
+
+// Read the contents of a stream into an array of bytes
+bool getStreamContents(sf::InputStream& stream, std::vector<std::uint8_t>& buffer)
+{
+    const std::optional size = stream.getSize();
+    if (!size || (*size == 0) || !stream.seek(0).has_value())
+        return false;
+
+    buffer.resize(*size);
+    return stream.read(buffer.data(), *size) == size;
+}
+
+// Get the OpenGL format of compressed pixels, 0 if they are not compressed
+GLenum getCompressedFormat(sf::priv::TextureContainer::Format format, bool sRgb)
+{
+    using Format = sf::priv::TextureContainer::Format;
+
+    switch (format)
+    {
+        case Format::Bc1Rgb:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB_S3TC_DXT1 : GLEXT_GL_COMPRESSED_RGB_S3TC_DXT1;
+        case Format::Bc1Rgba:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1 : GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT1;
+        case Format::Bc2:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3 : GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT3;
+        case Format::Bc3:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5 : GLEXT_GL_COMPRESSED_RGBA_S3TC_DXT5;
+        case Format::Bc7:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM : GLEXT_GL_COMPRESSED_RGBA_BPTC_UNORM;
+        case Format::Etc2Rgb8:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB8_ETC2 : GLEXT_GL_COMPRESSED_RGB8_ETC2;
+        case Format::Etc2Rgb8A1:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB8_ALPHA1_ETC2 : GLEXT_GL_COMPRESSED_RGB8_ALPHA1_ETC2;
+        case Format::Etc2Rgba8:
+            return sRgb ? GLEXT_GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC : GLEXT_GL_COMPRESSED_RGBA8_ETC2_EAC;
+        default:
+            return 0;
+    }
+}
+
+// Check whether the driver can store textures in the given compressed format
+bool isCompressedFormatSupported(GLenum format)
+{
+    if (!GLEXT_texture_compression)
+        return false;
+
+    // BPTC and ETC2 are core since OpenGL 4.2 and 4.3, but drivers don't always list them
+    if (GLEXT_GL_VERSION_4_2 &&
+        ((format == GLEXT_GL_COMPRESSED_RGBA_BPTC_UNORM) || (format == GLEXT_GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM)))
+        return true;
+
+    if (GLEXT_GL_VERSION_4_3 && (format >= GLEXT_GL_COMPRESSED_RGB8_ETC2) &&
+        (format <= GLEXT_GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC))
+        return true;
+
+    GLint count = 0;
+    glCheck(glGetIntegerv(GLEXT_GL_NUM_COMPRESSED_TEXTURE_FORMATS, &count));
+    if (count <= 0)
+        return false;
+
+    std::vector<GLint> formats(static_cast<std::size_t>(count));
+    glCheck(glGetIntegerv(GLEXT_GL_COMPRESSED_TEXTURE_FORMATS, formats.data()));
+    return std::find(formats.begin(), formats.end(), static_cast<GLint>(format)) != formats.end();
+}
 } // namespace TextureImpl
 } // namespace
 
@@ -67,7 +158,10 @@ std::uint64_t getUniqueId() noexcept
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-Texture::Texture() : m_cacheId(TextureImpl::getUniqueId())
+Texture::Texture() :
+m_cacheId(TextureImpl::getUniqueId()),
+m_layoutId(TextureImpl::getUniqueId()),
+m_batchGuard(std::make_shared<bool>())
 {
 }
 
@@ -150,7 +244,9 @@ GlResource(copy),
 m_isSmooth(copy.m_isSmooth),
 m_sRgb(copy.m_sRgb),
 m_isRepeated(copy.m_isRepeated),
-m_cacheId(TextureImpl::getUniqueId())
+m_cacheId(TextureImpl::getUniqueId()),
+m_layoutId(TextureImpl::getUniqueId()),
+m_batchGuard(std::make_shared<bool>())
 {
     if (copy.m_texture)
     {
@@ -197,7 +293,9 @@ m_isRepeated(std::exchange(right.m_isRepeated, false)),
 m_pixelsFlipped(std::exchange(right.m_pixelsFlipped, false)),
 m_fboAttachment(std::exchange(right.m_fboAttachment, false)),
 m_hasMipmap(std::exchange(right.m_hasMipmap, false)),
-m_cacheId(std::exchange(right.m_cacheId, 0))
+m_cacheId(std::exchange(right.m_cacheId, 0)),
+m_layoutId(TextureImpl::getUniqueId()),
+m_batchGuard(std::make_shared<bool>())
 {
 }
 
@@ -402,35 +500,147 @@ bool Texture::loadFromImage(const Image& image, bool sRgb, const IntRect& area)
     rectangle.size.x     = std::min(rectangle.size.x, size.x - rectangle.position.x);
     rectangle.size.y     = std::min(rectangle.size.y, size.y - rectangle.position.y);
 
-    // Create the texture and upload the pixels
+    // Create the texture and upload the pixels, the rows of the area are an image width apart
     if (resize(Vector2u(rectangle.size), sRgb))
     {
-        const TransientContextLock lock;
+        const std::uint8_t* pixels = image.getPixelsPtr() + 4 * (rectangle.position.x + (size.x * rectangle.position.y));
+        update(pixels, Vector2u(rectangle.size), {0, 0}, image.getSize().x);
 
-        // Make sure that the current texture binding will be preserved
-        const priv::TextureSaver save;
+        return true;
+    }
 
-        // Copy the pixels to the texture, row by row
-        const std::uint8_t* pixels = image.getPixelsPtr() + 4 * (rectangle.position.x + (size.x * rectangle.position.y));
-        glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
-        for (int i = 0; i < rectangle.size.y; ++i)
+    // Error message generated in called function.
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::loadFromCompressedFile(const std::filesystem::path& filename)
+{
+    std::vector<std::uint8_t> buffer;
+    if (!TextureImpl::getFileContents(filename, buffer))
+    {
+        err() << "Failed to open compressed texture file\n" << formatDebugPathInfo(filename) << std::endl;
+        return false;
+    }
+
+    return loadFromCompressedMemory(buffer.data(), buffer.size());
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::loadFromCompressedMemory(const void* data, std::size_t size)
+{
+    const std::optional<priv::TextureContainer> container = priv::parseTextureContainer(data, size);
+    if (!container)
+        return false;
+
+    const std::vector<priv::TextureContainer::Level>& levels = container->levels;
+
+    // Build the texture aside, so that this one is left unchanged if loading fails
+    Texture texture;
+    if (!texture.resize(levels.front().size, container->sRgb))
+        return false;
+
+    const TransientContextLock lock;
+
+    // Mipmap levels can't be padded, and are only used if the file contains all of them
+    const bool        padded     = texture.m_actualSize != texture.m_size;
+    const bool        mipmap     = !padded && (levels.size() > 1) && (levels.back().size == Vector2u(1, 1));
+    const std::size_t levelCount = mipmap ? levels.size() : 1;
+
+    const GLenum compressedFormat = padded ? 0 : TextureImpl::getCompressedFormat(container->format, texture.m_sRgb);
+
+    // Make sure that the current texture binding will be preserved
+    const priv::TextureSaver save;
+
+    glCheck(glBindTexture(GL_TEXTURE_2D, texture.m_texture));
+
+    if ((compressedFormat != 0) && TextureImpl::isCompressedFormatSupported(compressedFormat))
+    {
+        // Upload the blocks as they are, the graphics card decodes them when sampling the texture
+        for (std::size_t i = 0; i < levelCount; ++i)
+            glCheck(GLEXT_glCompressedTexImage2D(GL_TEXTURE_2D,
+                                                 static_cast<GLint>(i),
+                                                 compressedFormat,
+                                                 static_cast<GLsizei>(levels[i].size.x),
+                                                 static_cast<GLsizei>(levels[i].size.y),
+                                                 0,
+                                                 static_cast<GLsizei>(levels[i].byteSize),
+                                                 levels[i].data));
+    }
+    else
+    {
+        // Decode the pixels on the CPU, RGBA pixels can be uploaded as they are
+        std::vector<std::uint8_t> pixels;
+        for (std::size_t i = 0; i < levelCount; ++i)
         {
-            glCheck(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, i, rectangle.size.x, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
-            pixels += 4 * size.x;
+            const Vector2u      levelSize   = levels[i].size;
+            const std::uint8_t* levelPixels = levels[i].data;
+            if (container->format != priv::TextureContainer::Format::Rgba8)
+            {
+                pixels.resize(std::size_t{levelSize.x} * std::size_t{levelSize.y} * 4);
+                if (!priv::decodeTextureLevel(container->format, levels[i], pixels.data()))
+                {
+                    err() << "Failed to load compressed texture, its format is not supported by the graphics driver"
+                          << std::endl;
+                    return false;
+                }
+                levelPixels = pixels.data();
+            }
+
+            // The base level was allocated by resize, possibly padded
+            if (i == 0)
+                glCheck(glTexSubImage2D(GL_TEXTURE_2D,
+                                        0,
+                                        0,
+                                        0,
+                                        static_cast<GLsizei>(levelSize.x),
+                                        static_cast<GLsizei>(levelSize.y),
+                                        GL_RGBA,
+                                        GL_UNSIGNED_BYTE,
+                                        levelPixels));
+            else
+                glCheck(glTexImage2D(GL_TEXTURE_2D,
+                                     static_cast<GLint>(i),
+                                     (texture.m_sRgb ? GLEXT_GL_SRGB8_ALPHA8 : GL_RGBA),
+                                     static_cast<GLsizei>(levelSize.x),
+                                     static_cast<GLsizei>(levelSize.y),
+                                     0,
+                                     GL_RGBA,
+                                     GL_UNSIGNED_BYTE,
+                                     levelPixels));
         }
+    }
 
-        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
-        m_hasMipmap = false;
+    if (mipmap)
+    {
+        glCheck(glTexParameteri(GL_TEXTURE_2D,
+                                GL_TEXTURE_MIN_FILTER,
+                                texture.m_isSmooth ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_LINEAR));
+        texture.m_hasMipmap = true;
+    }
 
-        // Force an OpenGL flush, so that the texture will appear updated
-        // in all contexts immediately (solves problems in multi-threaded apps)
-        glCheck(glFlush());
+    // Force an OpenGL flush, so that the texture data will appear updated
+    // in all contexts immediately (solves problems in multi-threaded apps)
+    glCheck(glFlush());
 
-        return true;
+    *this = std::move(texture);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::loadFromCompressedStream(InputStream& stream)
+{
+    std::vector<std::uint8_t> buffer;
+    if (!TextureImpl::getStreamContents(stream, buffer))
+    {
+        err() << "Failed to read compressed texture from stream" << std::endl;
+        return false;
     }
 
-    // Error message generated in called function.
-    return false;
+    return loadFromCompressedMemory(buffer.data(), buffer.size());
 }
 
 
@@ -551,9 +761,17 @@ void Texture::update(const std::uint8_t* pixels)
 
 ////////////////////////////////////////////////////////////
 void Texture::update(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
+{
+    update(pixels, size, dest, size.x);
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::update(const std::uint8_t* pixels, Vector2u size, Vector2u dest, unsigned int stride)
 {
     assert(dest.x + size.x <= m_size.x && "Destination x coordinate is outside of texture");
     assert(dest.y + size.y <= m_size.y && "Destination y coordinate is outside of texture");
+    assert(stride >= size.x && "Stride is smaller than the width of the region");
 
     if (pixels && m_texture)
     {
@@ -562,6 +780,22 @@ void Texture::update(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
         // Make sure that the current texture binding will be preserved
         const priv::TextureSaver save;
 
+        // Rows that are not contiguous are either described to the driver with the unpack row length,
+        // or packed together on our side when it is not available: both upload the region in one call
+        std::vector<std::uint8_t> packedPixels;
+        const bool                useRowLength = (stride != size.x) && GLEXT_unpack_subimage;
+        if ((stride != size.x) && !useRowLength)
+        {
+            const std::size_t rowSize = std::size_t{size.x} * 4;
+            packedPixels.resize(rowSize * size.y);
+            for (std::size_t y = 0; y < size.y; ++y)
+                std::memcpy(packedPixels.data() + y * rowSize, pixels + y * std::size_t{stride} * 4, rowSize);
+            pixels = packedPixels.data();
+        }
+
+        if (useRowLength)
+            glCheck(glPixelStorei(GLEXT_GL_UNPACK_ROW_LENGTH, static_cast<GLint>(stride)));
+
         // Copy pixels from the given array to the texture
         glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
         glCheck(glTexSubImage2D(GL_TEXTURE_2D,
@@ -573,6 +807,11 @@ void Texture::update(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
                                 GL_RGBA,
                                 GL_UNSIGNED_BYTE,
                                 pixels));
+
+        // Restore the default, the rest of SFML assumes tightly packed rows
+        if (useRowLength)
+            glCheck(glPixelStorei(GLEXT_GL_UNPACK_ROW_LENGTH, 0));
+
         glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
         m_hasMipmap     = false;
         m_pixelsFlipped = false;
@@ -898,6 +1137,71 @@ bool Texture::generateMipmap()
 }
 
 
+////////////////////////////////////////////////////////////
+bool Texture::updateMipmap(const std::vector<Image>& levels)
+{
+    if (!m_texture || levels.empty())
+        return false;
+
+    // The levels are computed from the pixels of the image, they can't match a padded or flipped texture
+    if ((m_actualSize != m_size) || m_pixelsFlipped)
+    {
+        err() << "Failed to update texture mipmap, the texture is padded or flipped" << std::endl;
+        return false;
+    }
+
+    // Check that the levels form a complete mipmap chain
+    Vector2u size = m_size;
+    for (const Image& level : levels)
+    {
+        size = {std::max(size.x / 2, 1u), std::max(size.y / 2, 1u)};
+        if (level.getSize() != size)
+        {
+            err() << "Failed to update texture mipmap, invalid level size (" << level.getSize().x << "x"
+                  << level.getSize().y << ", expected " << size.x << "x" << size.y << ")" << std::endl;
+            return false;
+        }
+    }
+
+    if (size != Vector2u(1, 1))
+    {
+        err() << "Failed to update texture mipmap, the levels don't go down to 1x1" << std::endl;
+        return false;
+    }
+
+    const TransientContextLock lock;
+
+    // Make sure that the current texture binding will be preserved
+    const priv::TextureSaver save;
+
+    glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+    for (std::size_t i = 0; i < levels.size(); ++i)
+    {
+        const Vector2u levelSize = levels[i].getSize();
+        glCheck(glTexImage2D(GL_TEXTURE_2D,
+                             static_cast<GLint>(i + 1),
+                             (m_sRgb ? GLEXT_GL_SRGB8_ALPHA8 : GL_RGBA),
+                             static_cast<GLsizei>(levelSize.x),
+                             static_cast<GLsizei>(levelSize.y),
+                             0,
+                             GL_RGBA,
+                             GL_UNSIGNED_BYTE,
+                             levels[i].getPixelsPtr()));
+    }
+    glCheck(glTexParameteri(GL_TEXTURE_2D,
+                            GL_TEXTURE_MIN_FILTER,
+                            m_isSmooth ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_LINEAR));
+
+    m_hasMipmap = true;
+
+    // Force an OpenGL flush, so that the texture data will appear updated
+    // in all contexts immediately (solves problems in multi-threaded apps)
+    glCheck(glFlush());
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::invalidateMipmap()
 {
@@ -916,6 +1220,21 @@ void Texture::invalidateMipmap()
 }
 
 
+////////////////////////////////////////////////////////////
+bool Texture::invalidateLayout()
+{
+    // Render the draws pending on this thread while the pixels are still where their vertices expect them
+    RenderTarget::flushBatches(*this);
+
+    // The remaining batches belong to other threads, which are the only ones that can render them
+    if (m_batchGuard.use_count() > 1)
+        return false;
+
+    m_layoutId = TextureImpl::getUniqueId();
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::bind(const Texture* texture, CoordinateType coordinateType)
 {
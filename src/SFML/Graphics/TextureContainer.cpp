@@ -0,0 +1,518 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TextureContainer.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <ostream>
+
+#include <cstring>
+
+
+namespace
+{
+using Format = sf::priv::TextureContainer::Format;
+
+// Pixel format of a container, as described by its header
+struct FormatInfo
+{
+    Format format;
+    bool   sRgb;
+};
+
+// Read little-endian integers, whatever the endianness of the host
+std::uint32_t readUint32(const std::uint8_t* data)
+{
+    return std::uint32_t{data[0]} | (std::uint32_t{data[1]} << 8) | (std::uint32_t{data[2]} << 16) |
+           (std::uint32_t{data[3]} << 24);
+}
+
+std::uint64_t readUint64(const std::uint8_t* data)
+{
+    return std::uint64_t{readUint32(data)} | (std::uint64_t{readUint32(data + 4)} << 32);
+}
+
+constexpr std::uint32_t makeFourCC(char a, char b, char c, char d)
+{
+    return static_cast<std::uint32_t>(a) | (static_cast<std::uint32_t>(b) << 8) |
+           (static_cast<std::uint32_t>(c) << 16) | (static_cast<std::uint32_t>(d) << 24);
+}
+
+// Get the size of a mipmap level, each level being half the size of the previous one
+sf::Vector2u getLevelSize(sf::Vector2u size, std::size_t level)
+{
+    return {std::max(size.x >> level, 1u), std::max(size.y >> level, 1u)};
+}
+
+// Get the number of levels of a complete mipmap chain, down to 1x1
+std::size_t getMaxLevelCount(sf::Vector2u size)
+{
+    std::size_t count = 1;
+    for (unsigned int largest = std::max(size.x, size.y); largest > 1; largest /= 2)
+        ++count;
+    return count;
+}
+
+// Largest width or height accepted, so that the decoded pixels of a level (1 GiB at most)
+// can be addressed and uploaded on any platform
+constexpr unsigned int maxTextureDimension = 16384;
+
+// Get the size in bytes of the pixels of a level
+std::uint64_t getLevelByteSize(Format format, sf::Vector2u size)
+{
+    if (!sf::priv::isCompressedFormat(format))
+        return std::uint64_t{size.x} * std::uint64_t{size.y} * 4;
+
+    // Blocks of 4x4 pixels take 8 bytes in formats without alpha or with 1-bit alpha, 16 bytes otherwise
+    const bool smallBlocks = (format == Format::Bc1Rgb) || (format == Format::Bc1Rgba) ||
+                             (format == Format::Etc2Rgb8) || (format == Format::Etc2Rgb8A1);
+    return ((std::uint64_t{size.x} + 3) / 4) * ((std::uint64_t{size.y} + 3) / 4) * (smallBlocks ? 8 : 16);
+}
+
+// Describe the levels of a container, whose pixels start at `offsets[i]` in `data`
+bool addLevels(sf::priv::TextureContainer&       container,
+               sf::Vector2u                      size,
+               const std::vector<std::uint64_t>& offsets,
+               const std::uint8_t*               data,
+               std::size_t                       dataSize)
+{
+    if ((size.x == 0) || (size.y == 0) || (offsets.size() > getMaxLevelCount(size)))
+        return false;
+
+    for (std::size_t i = 0; i < offsets.size(); ++i)
+    {
+        const sf::Vector2u  levelSize = getLevelSize(size, i);
+        const std::uint64_t byteSize  = getLevelByteSize(container.format, levelSize);
+        if ((offsets[i] > dataSize) || (dataSize - offsets[i] < byteSize))
+            return false;
+
+        container.levels.push_back({levelSize, data + offsets[i], static_cast<std::size_t>(byteSize)});
+    }
+
+    return true;
+}
+
+// Get the pixel format of a DDS file from its DXGI format
+std::optional<FormatInfo> getDxgiFormat(std::uint32_t dxgiFormat)
+{
+    switch (dxgiFormat)
+    {
+        // clang-format off
+        case 28: return FormatInfo{Format::Rgba8, false};   // DXGI_FORMAT_R8G8B8A8_UNORM
+        case 29: return FormatInfo{Format::Rgba8, true};    // DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+        case 71: return FormatInfo{Format::Bc1Rgba, false}; // DXGI_FORMAT_BC1_UNORM
+        case 72: return FormatInfo{Format::Bc1Rgba, true};  // DXGI_FORMAT_BC1_UNORM_SRGB
+        case 74: return FormatInfo{Format::Bc2, false};     // DXGI_FORMAT_BC2_UNORM
+        case 75: return FormatInfo{Format::Bc2, true};      // DXGI_FORMAT_BC2_UNORM_SRGB
+        case 77: return FormatInfo{Format::Bc3, false};     // DXGI_FORMAT_BC3_UNORM
+        case 78: return FormatInfo{Format::Bc3, true};      // DXGI_FORMAT_BC3_UNORM_SRGB
+        case 87: return FormatInfo{Format::Bgra8, false};   // DXGI_FORMAT_B8G8R8A8_UNORM
+        case 91: return FormatInfo{Format::Bgra8, true};    // DXGI_FORMAT_B8G8R8A8_UNORM_SRGB
+        case 98: return FormatInfo{Format::Bc7, false};     // DXGI_FORMAT_BC7_UNORM
+        case 99: return FormatInfo{Format::Bc7, true};      // DXGI_FORMAT_BC7_UNORM_SRGB
+        default: return std::nullopt;
+            // clang-format on
+    }
+}
+
+// Get the pixel format of a KTX2 file from its Vulkan format
+std::optional<FormatInfo> getVulkanFormat(std::uint32_t vkFormat)
+{
+    switch (vkFormat)
+    {
+        // clang-format off
+        case 37:  return FormatInfo{Format::Rgba8, false};      // VK_FORMAT_R8G8B8A8_UNORM
+        case 43:  return FormatInfo{Format::Rgba8, true};       // VK_FORMAT_R8G8B8A8_SRGB
+        case 44:  return FormatInfo{Format::Bgra8, false};      // VK_FORMAT_B8G8R8A8_UNORM
+        case 50:  return FormatInfo{Format::Bgra8, true};       // VK_FORMAT_B8G8R8A8_SRGB
+        case 131: return FormatInfo{Format::Bc1Rgb, false};     // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+        case 132: return FormatInfo{Format::Bc1Rgb, true};      // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+        case 133: return FormatInfo{Format::Bc1Rgba, false};    // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+        case 134: return FormatInfo{Format::Bc1Rgba, true};     // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+        case 135: return FormatInfo{Format::Bc2, false};        // VK_FORMAT_BC2_UNORM_BLOCK
+        case 136: return FormatInfo{Format::Bc2, true};         // VK_FORMAT_BC2_SRGB_BLOCK
+        case 137: return FormatInfo{Format::Bc3, false};        // VK_FORMAT_BC3_UNORM_BLOCK
+        case 138: return FormatInfo{Format::Bc3, true};         // VK_FORMAT_BC3_SRGB_BLOCK
+        case 145: return FormatInfo{Format::Bc7, false};        // VK_FORMAT_BC7_UNORM_BLOCK
+        case 146: return FormatInfo{Format::Bc7, true};         // VK_FORMAT_BC7_SRGB_BLOCK
+        case 147: return FormatInfo{Format::Etc2Rgb8, false};   // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+        case 148: return FormatInfo{Format::Etc2Rgb8, true};    // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+        case 149: return FormatInfo{Format::Etc2Rgb8A1, false}; // VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK
+        case 150: return FormatInfo{Format::Etc2Rgb8A1, true};  // VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK
+        case 151: return FormatInfo{Format::Etc2Rgba8, false};  // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+        case 152: return FormatInfo{Format::Etc2Rgba8, true};   // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+        default:  return std::nullopt;
+            // clang-format on
+    }
+}
+
+// Parse a DirectDraw Surface file
+std::optional<sf::priv::TextureContainer> parseDds(const std::uint8_t* data, std::size_t size)
+{
+    constexpr std::size_t   headerSize      = 128;
+    constexpr std::size_t   dx10HeaderSize  = 20;
+    constexpr std::uint32_t mipMapCountFlag = 0x20000;
+    constexpr std::uint32_t alphaPixelsFlag = 0x1;
+    constexpr std::uint32_t fourCCFlag      = 0x4;
+    constexpr std::uint32_t rgbFlag         = 0x40;
+    constexpr std::uint32_t cubeMapFlags    = 0x200;
+    constexpr std::uint32_t volumeFlag      = 0x200000;
+
+    if ((size < headerSize) || (readUint32(data + 4) != 124) || (readUint32(data + 76) != 32))
+    {
+        sf::err() << "Failed to load DDS texture, invalid header" << std::endl;
+        return std::nullopt;
+    }
+
+    const std::uint32_t flags       = readUint32(data + 8);
+    const sf::Vector2u  textureSize = {readUint32(data + 16), readUint32(data + 12)};
+    const std::uint32_t levelCount  = (flags & mipMapCountFlag) ? std::max(readUint32(data + 28), 1u) : 1u;
+    const std::uint32_t pixelFlags  = readUint32(data + 80);
+    const std::uint32_t fourCC      = readUint32(data + 84);
+
+    if (readUint32(data + 112) & (cubeMapFlags | volumeFlag))
+    {
+        sf::err() << "Failed to load DDS texture, cube maps and volume textures are not supported" << std::endl;
+        return std::nullopt;
+    }
+
+    if ((textureSize.x > maxTextureDimension) || (textureSize.y > maxTextureDimension))
+    {
+        sf::err() << "Failed to load DDS texture, its size exceeds " << maxTextureDimension << " pixels" << std::endl;
+        return std::nullopt;
+    }
+
+    std::optional<FormatInfo> format;
+    std::uint64_t             offset = headerSize;
+
+    if ((pixelFlags & fourCCFlag) && (fourCC == makeFourCC('D', 'X', '1', '0')))
+    {
+        // Extended header, only 2D textures which are not arrays are supported
+        if ((size < headerSize + dx10HeaderSize) || (readUint32(data + 132) != 3) || (readUint32(data + 140) > 1))
+        {
+            sf::err() << "Failed to load DDS texture, only single 2D textures are supported" << std::endl;
+            return std::nullopt;
+        }
+
+        format = getDxgiFormat(readUint32(data + 128));
+        offset += dx10HeaderSize;
+    }
+    else if (pixelFlags & fourCCFlag)
+    {
+        if (fourCC == makeFourCC('D', 'X', 'T', '1'))
+            format = FormatInfo{Format::Bc1Rgba, false};
+        else if (fourCC == makeFourCC('D', 'X', 'T', '3'))
+            format = FormatInfo{Format::Bc2, false};
+        else if (fourCC == makeFourCC('D', 'X', 'T', '5'))
+            format = FormatInfo{Format::Bc3, false};
+    }
+    else if ((pixelFlags & rgbFlag) && (pixelFlags & alphaPixelsFlag) && (readUint32(data + 88) == 32) &&
+             (readUint32(data + 104) == 0xFF000000))
+    {
+        // Uncompressed pixels, the masks tell in which order the components are stored
+        const std::uint32_t redMask  = readUint32(data + 92);
+        const std::uint32_t blueMask = readUint32(data + 100);
+        if ((redMask == 0x000000FF) && (blueMask == 0x00FF0000))
+            format = FormatInfo{Format::Rgba8, false};
+        else if ((redMask == 0x00FF0000) && (blueMask == 0x000000FF))
+            format = FormatInfo{Format::Bgra8, false};
+    }
+
+    if (!format)
+    {
+        sf::err() << "Failed to load DDS texture, unsupported pixel format" << std::endl;
+        return std::nullopt;
+    }
+
+    sf::priv::TextureContainer container;
+    container.format = format->format;
+    container.sRgb   = format->sRgb;
+
+    // Levels are stored one after the other, starting with the base level
+    std::vector<std::uint64_t> offsets;
+    for (std::uint32_t i = 0; (i < levelCount) && (i < 32); ++i)
+    {
+        offsets.push_back(offset);
+        offset += getLevelByteSize(container.format, getLevelSize(textureSize, i));
+    }
+
+    if ((levelCount > 32) || !addLevels(container, textureSize, offsets, data, size))
+    {
+        sf::err() << "Failed to load DDS texture, invalid size or truncated data" << std::endl;
+        return std::nullopt;
+    }
+
+    return container;
+}
+
+// Parse a Khronos Texture 2 file
+std::optional<sf::priv::TextureContainer> parseKtx2(const std::uint8_t* data, std::size_t size)
+{
+    constexpr std::size_t headerSize     = 80;
+    constexpr std::size_t levelIndexSize = 24;
+
+    if (size < headerSize)
+    {
+        sf::err() << "Failed to load KTX2 texture, invalid header" << std::endl;
+        return std::nullopt;
+    }
+
+    const std::uint32_t vkFormat    = readUint32(data + 12);
+    const sf::Vector2u  textureSize = {readUint32(data + 20), readUint32(data + 24)};
+    const std::uint32_t depth       = readUint32(data + 28);
+    const std::uint32_t layerCount  = readUint32(data + 32);
+    const std::uint32_t faceCount   = readUint32(data + 36);
+    const std::uint32_t levelCount  = std::max(readUint32(data + 40), 1u);
+
+    if ((depth != 0) || (layerCount > 1) || (faceCount != 1))
+    {
+        sf::err() << "Failed to load KTX2 texture, only single 2D textures are supported" << std::endl;
+        return std::nullopt;
+    }
+
+    if ((textureSize.x > maxTextureDimension) || (textureSize.y > maxTextureDimension))
+    {
+        sf::err() << "Failed to load KTX2 texture, its size exceeds " << maxTextureDimension << " pixels" << std::endl;
+        return std::nullopt;
+    }
+
+    if (readUint32(data + 44) != 0)
+    {
+        sf::err() << "Failed to load KTX2 texture, supercompression is not supported" << std::endl;
+        return std::nullopt;
+    }
+
+    const std::optional<FormatInfo> format = getVulkanFormat(vkFormat);
+    if (!format)
+    {
+        sf::err() << "Failed to load KTX2 texture, unsupported pixel format (" << vkFormat << ")" << std::endl;
+        return std::nullopt;
+    }
+
+    sf::priv::TextureContainer container;
+    container.format = format->format;
+    container.sRgb   = format->sRgb;
+
+    // The level index gives the location of each level, starting with the base level
+    std::vector<std::uint64_t> offsets;
+    for (std::uint32_t i = 0; (i < levelCount) && (i < 32) && (headerSize + (i + 1) * levelIndexSize <= size); ++i)
+        offsets.push_back(readUint64(data + headerSize + i * levelIndexSize));
+
+    if ((offsets.size() != levelCount) || !addLevels(container, textureSize, offsets, data, size))
+    {
+        sf::err() << "Failed to load KTX2 texture, invalid size or truncated data" << std::endl;
+        return std::nullopt;
+    }
+
+    return container;
+}
+
+// Expand a RGB565 color to 8 bits per component
+std::array<std::uint8_t, 4> expandColor565(std::uint32_t color)
+{
+    const std::uint32_t red   = (color >> 11) & 0x1F;
+    const std::uint32_t green = (color >> 5) & 0x3F;
+    const std::uint32_t blue  = color & 0x1F;
+    return {static_cast<std::uint8_t>((red << 3) | (red >> 2)),
+            static_cast<std::uint8_t>((green << 2) | (green >> 4)),
+            static_cast<std::uint8_t>((blue << 3) | (blue >> 2)),
+            255};
+}
+
+// Decode the color part of a BC1, BC2 or BC3 block to 4x4 RGBA pixels
+void decodeColorBlock(const std::uint8_t* block, bool isBc1, bool hasAlpha, std::uint8_t* pixels)
+{
+    const std::uint32_t color0 = block[0] | (std::uint32_t{block[1]} << 8);
+    const std::uint32_t color1 = block[2] | (std::uint32_t{block[3]} << 8);
+
+    // Only BC1 has a 3 colors mode, where the 4th color is black (transparent with alpha)
+    std::array<std::array<std::uint8_t, 4>, 4> palette{expandColor565(color0), expandColor565(color1)};
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        const unsigned int first  = palette[0][i];
+        const unsigned int second = palette[1][i];
+        if (!isBc1 || (color0 > color1))
+        {
+            palette[2][i] = static_cast<std::uint8_t>((2 * first + second) / 3);
+            palette[3][i] = static_cast<std::uint8_t>((first + 2 * second) / 3);
+        }
+        else
+        {
+            palette[2][i] = static_cast<std::uint8_t>((first + second) / 2);
+            palette[3][i] = 0;
+        }
+    }
+    palette[2][3] = 255;
+    palette[3][3] = (isBc1 && hasAlpha && (color0 <= color1)) ? 0 : 255;
+
+    const std::uint32_t indices = readUint32(block + 4);
+    for (std::size_t i = 0; i < 16; ++i)
+        std::memcpy(pixels + i * 4, palette[(indices >> (2 * i)) & 3].data(), 4);
+}
+
+// Decode the explicit alpha part of a BC2 block
+void decodeExplicitAlphaBlock(const std::uint8_t* block, std::uint8_t* pixels)
+{
+    const std::uint64_t alphas = readUint64(block);
+    for (std::size_t i = 0; i < 16; ++i)
+        pixels[i * 4 + 3] = static_cast<std::uint8_t>(((alphas >> (4 * i)) & 0xF) * 17);
+}
+
+// Decode the interpolated alpha part of a BC3 block
+void decodeInterpolatedAlphaBlock(const std::uint8_t* block, std::uint8_t* pixels)
+{
+    const unsigned int first  = block[0];
+    const unsigned int second = block[1];
+
+    std::array<std::uint8_t, 8> palette{static_cast<std::uint8_t>(first), static_cast<std::uint8_t>(second)};
+    if (first > second)
+    {
+        for (unsigned int i = 1; i < 7; ++i)
+            palette[i + 1] = static_cast<std::uint8_t>(((7 - i) * first + i * second) / 7);
+    }
+    else
+    {
+        for (unsigned int i = 1; i < 5; ++i)
+            palette[i + 1] = static_cast<std::uint8_t>(((5 - i) * first + i * second) / 5);
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    const std::uint64_t indices = readUint64(block) >> 16;
+    for (std::size_t i = 0; i < 16; ++i)
+        pixels[i * 4 + 3] = palette[(indices >> (3 * i)) & 7];
+}
+
+// Decode a level made of BC1, BC2 or BC3 blocks
+void decodeBlocks(Format format, const sf::priv::TextureContainer::Level& level, std::uint8_t* pixels)
+{
+    const std::size_t blockSize = ((format == Format::Bc1Rgb) || (format == Format::Bc1Rgba)) ? 8 : 16;
+    const std::size_t width     = level.size.x;
+    const std::size_t height    = level.size.y;
+
+    const std::uint8_t*          block = level.data;
+    std::array<std::uint8_t, 64> decoded{};
+
+    for (std::size_t blockY = 0; blockY < height; blockY += 4)
+    {
+        for (std::size_t blockX = 0; blockX < width; blockX += 4)
+        {
+            switch (format)
+            {
+                case Format::Bc1Rgb:
+                    decodeColorBlock(block, true, false, decoded.data());
+                    break;
+                case Format::Bc1Rgba:
+                    decodeColorBlock(block, true, true, decoded.data());
+                    break;
+                case Format::Bc2:
+                    decodeColorBlock(block + 8, false, false, decoded.data());
+                    decodeExplicitAlphaBlock(block, decoded.data());
+                    break;
+                default:
+                    decodeColorBlock(block + 8, false, false, decoded.data());
+                    decodeInterpolatedAlphaBlock(block, decoded.data());
+                    break;
+            }
+
+            // Blocks on the right and bottom edges may be partially outside of the level
+            const std::size_t columns = std::min<std::size_t>(4, width - blockX);
+            const std::size_t rows    = std::min<std::size_t>(4, height - blockY);
+            for (std::size_t y = 0; y < rows; ++y)
+                std::memcpy(pixels + ((blockY + y) * width + blockX) * 4, decoded.data() + y * 16, columns * 4);
+
+            block += blockSize;
+        }
+    }
+}
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+std::optional<TextureContainer> parseTextureContainer(const void* data, std::size_t size)
+{
+    static constexpr std::array<std::uint8_t, 4>  ddsMagic{'D', 'D', 'S', ' '};
+    static constexpr std::array<std::uint8_t, 12> ktx2Identifier{
+        0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+
+    if (bytes && (size >= ddsMagic.size()) && std::equal(ddsMagic.begin(), ddsMagic.end(), bytes))
+        return parseDds(bytes, size);
+
+    if (bytes && (size >= ktx2Identifier.size()) && std::equal(ktx2Identifier.begin(), ktx2Identifier.end(), bytes))
+        return parseKtx2(bytes, size);
+
+    err() << "Failed to load texture container, only DDS and KTX2 files are supported" << std::endl;
+    return std::nullopt;
+}
+
+
+////////////////////////////////////////////////////////////
+bool isCompressedFormat(TextureContainer::Format format)
+{
+    return (format != TextureContainer::Format::Rgba8) && (format != TextureContainer::Format::Bgra8);
+}
+
+
+////////////////////////////////////////////////////////////
+bool decodeTextureLevel(TextureContainer::Format format, const TextureContainer::Level& level, std::uint8_t* pixels)
+{
+    switch (format)
+    {
+        case TextureContainer::Format::Rgba8:
+            std::memcpy(pixels, level.data, level.byteSize);
+            return true;
+
+        case TextureContainer::Format::Bgra8:
+            for (std::size_t i = 0; i < level.byteSize; i += 4)
+            {
+                pixels[i + 0] = level.data[i + 2];
+                pixels[i + 1] = level.data[i + 1];
+                pixels[i + 2] = level.data[i + 0];
+                pixels[i + 3] = level.data[i + 3];
+            }
+            return true;
+
+        case TextureContainer::Format::Bc1Rgb:
+        case TextureContainer::Format::Bc1Rgba:
+        case TextureContainer::Format::Bc2:
+        case TextureContainer::Format::Bc3:
+            decodeBlocks(format, level, pixels);
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+} // namespace sf::priv
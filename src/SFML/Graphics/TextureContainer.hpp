@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Texture stored in a DDS or KTX2 container
+///
+/// The levels point into the memory the container was parsed
+/// from, nothing is copied.
+///
+////////////////////////////////////////////////////////////
+struct TextureContainer
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Formats of the pixels stored in a container
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Format
+    {
+        Rgba8,      //!< Uncompressed, 8 bits per component in RGBA order
+        Bgra8,      //!< Uncompressed, 8 bits per component in BGRA order
+        Bc1Rgb,     //!< BC1 (DXT1), opaque
+        Bc1Rgba,    //!< BC1 (DXT1) with 1-bit alpha
+        Bc2,        //!< BC2 (DXT3), explicit alpha
+        Bc3,        //!< BC3 (DXT5), interpolated alpha
+        Bc7,        //!< BC7 (BPTC)
+        Etc2Rgb8,   //!< ETC2, opaque
+        Etc2Rgb8A1, //!< ETC2 with 1-bit alpha
+        Etc2Rgba8   //!< ETC2 with EAC alpha
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mipmap level of a container
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Level
+    {
+        Vector2u            size;       //!< Size of the level, in pixels
+        const std::uint8_t* data{};     //!< Pixel data of the level
+        std::size_t         byteSize{}; //!< Size of the pixel data, in bytes
+    };
+
+    Format             format{}; //!< Format of the pixels
+    bool               sRgb{};   //!< Are the colors sRGB encoded?
+    std::vector<Level> levels;   //!< Mipmap levels, starting with the base level
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Parse a DDS or KTX2 container
+///
+/// Only 2D textures are supported: cube maps, arrays, volume
+/// textures and supercompressed KTX2 files are rejected.
+///
+/// \param data Pointer to the file data in memory
+/// \param size Size of the data to load, in bytes
+///
+/// \return Description of the texture, or `std::nullopt` if the data is not a supported container
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::optional<TextureContainer> parseTextureContainer(const void* data, std::size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Check whether pixels of the given format are block compressed
+///
+/// \param format Format to check
+///
+/// \return `true` if the pixels are compressed in blocks of 4x4 pixels
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isCompressedFormat(TextureContainer::Format format);
+
+////////////////////////////////////////////////////////////
+/// \brief Decode a level of a container to RGBA pixels
+///
+/// BC1, BC2 and BC3 are decompressed, uncompressed formats are
+/// converted. Other compressed formats can only be decoded by
+/// the graphics driver.
+///
+/// \param format Format of the level's pixels
+/// \param level  Level to decode
+/// \param pixels Destination array of `level.size.x * level.size.y * 4` bytes
+///
+/// \return `true` if the level was decoded, `false` if its format can't be decoded on the CPU
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool decodeTextureLevel(TextureContainer::Format       format,
+                                      const TextureContainer::Level& level,
+                                      std::uint8_t*                  pixels);
+
+} // namespace sf::priv
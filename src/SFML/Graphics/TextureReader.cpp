@@ -0,0 +1,316 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureReader.hpp>
+#include <SFML/Graphics/TextureSaver.hpp>
+
+#include <SFML/Window/Context.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <ostream>
+#include <utility>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct TextureReader::Buffer
+{
+    Vector2u             size;       //!< Size of the texture that was read
+    std::optional<Image> image;      //!< Pixels copied synchronously, when asynchronous readback is not available
+#ifndef SFML_OPENGL_ES
+    GLuint               buffer{};   //!< Pixel buffer object receiving the pixels
+    std::size_t          capacity{}; //!< Size of the storage of the pixel buffer object, in bytes
+    GLEXT_GLsync         fence{};    //!< Fence signaled when the transfer is complete
+    Vector2u             actualSize; //!< Actual size of the texture, including padding
+    bool                 flipped{};  //!< Are the pixels of the texture flipped vertically?
+#endif
+};
+
+
+////////////////////////////////////////////////////////////
+TextureReader::TextureReader(std::size_t bufferCount) : m_buffers(std::max(bufferCount, std::size_t{1}))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReader::~TextureReader()
+{
+#ifndef SFML_OPENGL_ES
+
+    const TransientContextLock lock;
+
+    for (Buffer& buffer : m_buffers)
+    {
+        if (buffer.fence)
+            glCheck(GLEXT_glDeleteSync(buffer.fence));
+
+        if (buffer.buffer)
+            glCheck(GLEXT_glDeleteBuffers(1, &buffer.buffer));
+    }
+
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReader::TextureReader(TextureReader&& right) noexcept :
+m_buffers(std::exchange(right.m_buffers, {})),
+m_first(std::exchange(right.m_first, 0)),
+m_pendingCount(std::exchange(right.m_pendingCount, 0))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReader& TextureReader::operator=(TextureReader&& right) noexcept
+{
+    // Our buffers are released by right when it is destroyed
+    std::swap(m_buffers, right.m_buffers);
+    std::swap(m_first, right.m_first);
+    std::swap(m_pendingCount, right.m_pendingCount);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureReader::read(const Texture& texture)
+{
+    if (!texture.m_texture || (m_pendingCount == m_buffers.size()))
+        return false;
+
+    Buffer& buffer = m_buffers[(m_first + m_pendingCount) % m_buffers.size()];
+    buffer.size    = texture.m_size;
+
+    if (!isAvailable())
+    {
+        buffer.image = texture.copyToImage();
+        ++m_pendingCount;
+        return true;
+    }
+
+#ifndef SFML_OPENGL_ES
+
+    const TransientContextLock lock;
+
+    // Make sure that the current texture binding will be preserved
+    const priv::TextureSaver save;
+
+    buffer.actualSize = texture.m_actualSize;
+    buffer.flipped    = texture.m_pixelsFlipped;
+
+    if (!buffer.buffer)
+    {
+        glCheck(GLEXT_glGenBuffers(1, &buffer.buffer));
+
+        if (!buffer.buffer)
+        {
+            err() << "Could not create pixel buffer object for texture readback" << std::endl;
+            return false;
+        }
+    }
+
+    // Grow the buffer if needed, the storage is kept between readbacks of textures of the same size
+    const std::size_t byteCount = std::size_t{buffer.actualSize.x} * std::size_t{buffer.actualSize.y} * 4;
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, buffer.buffer));
+    if (buffer.capacity < byteCount)
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_PACK_BUFFER,
+                                   static_cast<GLsizeiptrARB>(byteCount),
+                                   nullptr,
+                                   GLEXT_GL_STREAM_READ));
+        buffer.capacity = byteCount;
+    }
+
+    // With a pixel pack buffer bound, the pixels are written to its storage and the call returns immediately
+    glCheck(glBindTexture(GL_TEXTURE_2D, texture.m_texture));
+    glCheck(glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+    buffer.fence = glCheck(GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+    // Submit the commands, so that the fence can be signaled even if the context isn't used anymore
+    glCheck(glFlush());
+
+    ++m_pendingCount;
+    return true;
+
+#else
+
+    return false;
+
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureReader::getPendingCount() const
+{
+    return m_pendingCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Image> TextureReader::poll()
+{
+    if (m_pendingCount == 0)
+        return std::nullopt;
+
+#ifndef SFML_OPENGL_ES
+
+    if (const Buffer& buffer = m_buffers[m_first]; buffer.fence)
+    {
+        const TransientContextLock lock;
+
+        // A zero timeout only queries the state of the fence
+        if (glCheck(GLEXT_glClientWaitSync(buffer.fence, 0, 0)) == GLEXT_GL_TIMEOUT_EXPIRED)
+            return std::nullopt;
+    }
+
+#endif
+
+    return retrieve();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Image> TextureReader::wait()
+{
+    if (m_pendingCount == 0)
+        return std::nullopt;
+
+#ifndef SFML_OPENGL_ES
+
+    if (const Buffer& buffer = m_buffers[m_first]; buffer.fence)
+    {
+        const TransientContextLock lock;
+
+        // Wait for the transfer by steps of one second, mapping the buffer would wait anyway if the fence failed
+        GLenum status = GLEXT_GL_TIMEOUT_EXPIRED;
+        while (status == GLEXT_GL_TIMEOUT_EXPIRED)
+            status = glCheck(GLEXT_glClientWaitSync(buffer.fence, GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000'000));
+
+        if (status == GLEXT_GL_WAIT_FAILED)
+            err() << "Failed to wait for texture readback" << std::endl;
+    }
+
+#endif
+
+    return retrieve();
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureReader::isAvailable()
+{
+#ifndef SFML_OPENGL_ES
+
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return GLEXT_pixel_buffer_object && GLEXT_sync;
+    }();
+
+    return available;
+
+#else
+
+    return false;
+
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+Image TextureReader::retrieve()
+{
+    assert(m_pendingCount > 0 && "TextureReader::retrieve() called without pending readback");
+
+    Buffer& buffer = m_buffers[m_first];
+    m_first        = (m_first + 1) % m_buffers.size();
+    --m_pendingCount;
+
+    if (buffer.image)
+        return *std::exchange(buffer.image, std::nullopt);
+
+    Image image;
+
+#ifndef SFML_OPENGL_ES
+
+    const TransientContextLock lock;
+
+    glCheck(GLEXT_glDeleteSync(buffer.fence));
+    buffer.fence = {};
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, buffer.buffer));
+
+    if (const void* const mapped = glCheck(GLEXT_glMapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, GLEXT_GL_READ_ONLY)))
+    {
+        const auto* pixels = static_cast<const std::uint8_t*>(mapped);
+
+        // Copy the useful pixels, skipping the padding and restoring the orientation of flipped textures
+        const std::size_t srcPitch = std::size_t{buffer.actualSize.x} * 4;
+        const std::size_t dstPitch = std::size_t{buffer.size.x} * 4;
+
+        Image::PixelBuffer copy(new std::uint8_t[dstPitch * buffer.size.y]);
+        for (std::size_t y = 0; y < buffer.size.y; ++y)
+        {
+            const std::size_t srcRow = buffer.flipped ? (buffer.size.y - 1 - y) : y;
+            std::memcpy(copy.get() + y * dstPitch, pixels + srcRow * srcPitch, dstPitch);
+        }
+
+        image.resize(buffer.size, std::move(copy));
+
+        glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER));
+    }
+    else
+    {
+        err() << "Failed to map pixel buffer object for texture readback" << std::endl;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+#endif
+
+    return image;
+}
+
+} // namespace sf
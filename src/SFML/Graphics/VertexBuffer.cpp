@@ -57,6 +57,84 @@ GLenum usageToGlEnum(sf::VertexBuffer::Usage usage)
             return GLEXT_GL_STREAM_DRAW;
     }
 }
+
+
+#ifndef SFML_OPENGL_ES
+
+// Give fresh storage to a buffer while keeping its contents outside of the range that is
+// about to be rewritten: the kept vertices go through a temporary buffer with copies that
+// are queued on the GPU like the draws that still read the previous storage, so the CPU
+// doesn't wait for either
+bool orphanKeepingData(GLuint buffer, std::size_t bufferSize, std::size_t offset, std::size_t size, GLenum usage)
+{
+    GLuint temporary = 0;
+    glCheck(GLEXT_glGenBuffers(1, &temporary));
+
+    if (!temporary)
+        return false;
+
+    const auto copyKeptData = [&]
+    {
+        if (offset > 0)
+            glCheck(GLEXT_glCopyBufferSubData(GLEXT_GL_COPY_READ_BUFFER,
+                                              GLEXT_GL_COPY_WRITE_BUFFER,
+                                              0,
+                                              0,
+                                              static_cast<GLsizeiptr>(offset)));
+
+        if (offset + size < bufferSize)
+            glCheck(GLEXT_glCopyBufferSubData(GLEXT_GL_COPY_READ_BUFFER,
+                                              GLEXT_GL_COPY_WRITE_BUFFER,
+                                              static_cast<GLintptr>(offset + size),
+                                              static_cast<GLintptr>(offset + size),
+                                              static_cast<GLsizeiptr>(bufferSize - offset - size)));
+    };
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, buffer));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, temporary));
+    glCheck(GLEXT_glBufferData(GLEXT_GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptrARB>(bufferSize), nullptr, usage));
+    copyKeptData();
+
+    glCheck(GLEXT_glBufferData(GLEXT_GL_COPY_READ_BUFFER, static_cast<GLsizeiptrARB>(bufferSize), nullptr, usage));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, temporary));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, buffer));
+    copyKeptData();
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, 0));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, 0));
+    glCheck(GLEXT_glDeleteBuffers(1, &temporary));
+
+    return true;
+}
+
+
+// Write to a part of the bound array buffer, which must have been orphaned since its last
+// draw, without synchronizing with the GPU: the fresh storage is not in use by any draw
+bool streamData(std::size_t offset, std::size_t size, const void* data)
+{
+    // Zero-sized mappings are invalid
+    if (size == 0)
+        return true;
+
+    const GLbitfield access = GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_INVALIDATE_RANGE_BIT |
+                              GLEXT_GL_MAP_UNSYNCHRONIZED_BIT;
+
+    void* const destination = glCheck(GLEXT_glMapBufferRange(GLEXT_GL_ARRAY_BUFFER,
+                                                             static_cast<GLintptr>(offset),
+                                                             static_cast<GLsizeiptr>(size),
+                                                             access));
+
+    if (!destination)
+        return false;
+
+    std::memcpy(destination, data, size);
+
+    // The contents of the mapping may be lost (e.g. on display mode changes)
+    return glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER)) == GL_TRUE;
+}
+
+#endif // SFML_OPENGL_ES
 } // namespace VertexBufferImpl
 } // namespace
 
@@ -175,7 +253,8 @@ bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsig
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
 
     // Check if we need to resize or orphan the buffer
-    if (vertexCount >= m_size)
+    bool orphaned = (vertexCount >= m_size);
+    if (orphaned)
     {
         glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
                                    static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
@@ -185,10 +264,36 @@ bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsig
         m_size = vertexCount;
     }
 
-    glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
-                                  static_cast<GLintptrARB>(sizeof(Vertex) * offset),
-                                  static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
-                                  vertices));
+    bool streamed = false;
+
+#ifndef SFML_OPENGL_ES
+
+    // Stream buffers are rewritten while the GPU may still be drawing their previous
+    // contents: orphan them for partial updates too, and write the new vertices without
+    // synchronizing with the GPU if the driver allows it
+    if (m_usage == Usage::Stream)
+    {
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        if (!orphaned && GLEXT_copy_buffer && GLEXT_map_buffer_range)
+            orphaned = VertexBufferImpl::orphanKeepingData(m_buffer,
+                                                           sizeof(Vertex) * m_size,
+                                                           sizeof(Vertex) * offset,
+                                                           sizeof(Vertex) * vertexCount,
+                                                           VertexBufferImpl::usageToGlEnum(m_usage));
+
+        if (orphaned && GLEXT_map_buffer_range)
+            streamed = VertexBufferImpl::streamData(sizeof(Vertex) * offset, sizeof(Vertex) * vertexCount, vertices);
+    }
+
+#endif // SFML_OPENGL_ES
+
+    if (!streamed)
+        glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                      static_cast<GLintptrARB>(sizeof(Vertex) * offset),
+                                      static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                                      vertices));
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
 
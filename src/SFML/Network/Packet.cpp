@@ -31,12 +31,87 @@
 #include <SFML/System/String.hpp>
 #include <SFML/System/Utils.hpp>
 
+#include <algorithm>
 #include <array>
+#include <limits>
+#include <type_traits>
 
 #include <cassert>
+#include <cmath>
 #include <cstring>
 #include <cwchar>
 
+// SSE2 and NEON are part of the baseline of x86-64 and ARM64, no runtime detection is needed
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define SFML_PACKET_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define SFML_PACKET_NEON
+#endif
+
+
+namespace
+{
+// Reverse the bytes of each of the `count` elements of `Size` bytes, in place
+template <std::size_t Size>
+void swapBytes(std::byte* data, std::size_t count)
+{
+    static_assert((Size == 2) || (Size == 4) || (Size == 8), "Unsupported element size");
+
+    const std::size_t size = count * Size;
+    std::size_t       i    = 0;
+
+#if defined(SFML_PACKET_SSE2)
+
+    // Swap the 16-bit words of each element, then the bytes of each word
+    constexpr int wordOrder = (Size == 8) ? _MM_SHUFFLE(0, 1, 2, 3) : _MM_SHUFFLE(2, 3, 0, 1);
+    for (; i + 16 <= size; i += 16)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        if constexpr (Size > 2)
+        {
+            values = _mm_shufflelo_epi16(values, wordOrder);
+            values = _mm_shufflehi_epi16(values, wordOrder);
+        }
+        values = _mm_or_si128(_mm_slli_epi16(values, 8), _mm_srli_epi16(values, 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), values);
+    }
+
+#elif defined(SFML_PACKET_NEON)
+
+    for (; i + 16 <= size; i += 16)
+    {
+        auto*            bytes  = reinterpret_cast<std::uint8_t*>(data + i);
+        const uint8x16_t values = vld1q_u8(bytes);
+        if constexpr (Size == 2)
+            vst1q_u8(bytes, vrev16q_u8(values));
+        else if constexpr (Size == 4)
+            vst1q_u8(bytes, vrev32q_u8(values));
+        else
+            vst1q_u8(bytes, vrev64q_u8(values));
+    }
+
+#endif
+
+    for (; i < size; i += Size)
+        std::reverse(data + i, data + i + Size);
+}
+
+
+// Convert values between host and network byte order, in place
+template <typename T>
+void convertByteOrder([[maybe_unused]] std::byte* data, [[maybe_unused]] std::size_t count)
+{
+    // Like with the stream operators, only integers are converted, floating point numbers are kept as is
+    if constexpr (std::is_integral_v<T> && (sizeof(T) > 1))
+    {
+        if (htons(1) != 1)
+            swapBytes<sizeof(T)>(data, count);
+    }
+}
+} // namespace
+
 
 namespace sf
 {
@@ -52,6 +127,13 @@ void Packet::append(const void* data, std::size_t sizeInBytes)
 }
 
 
+////////////////////////////////////////////////////////////
+void Packet::reserve(std::size_t sizeInBytes)
+{
+    m_data.reserve(sizeInBytes);
+}
+
+
 ////////////////////////////////////////////////////////////
 std::size_t Packet::getReadPosition() const
 {
@@ -568,10 +650,306 @@ Packet& Packet::operator<<(const String& data)
 }
 
 
+////////////////////////////////////////////////////////////
+template <typename T>
+Packet& Packet::readArray(T* data, std::size_t count)
+{
+    assert((data || (count == 0)) && "Packet::read Data must not be null");
+
+    // Make sure that the total size doesn't overflow
+    if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        m_isValid = false;
+
+    const std::size_t size = sizeof(T) * count;
+    if (checkSize(size) && (size > 0))
+    {
+        std::memcpy(data, &m_data[m_readPos], size);
+        convertByteOrder<T>(reinterpret_cast<std::byte*>(data), count);
+        m_readPos += size;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+Packet& Packet::writeArray(const T* data, std::size_t count)
+{
+    assert((data || (count == 0)) && "Packet::write Data must not be null");
+
+    if (count > 0)
+    {
+        const std::size_t offset = m_data.size();
+        append(data, sizeof(T) * count);
+        convertByteOrder<T>(m_data.data() + offset, count);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(std::int8_t* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(std::uint8_t* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(std::int16_t* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(std::uint16_t* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(std::int32_t* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(std::uint32_t* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(std::int64_t* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(std::uint64_t* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(float* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::read(double* data, std::size_t count)
+{
+    return readArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const std::int8_t* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const std::uint8_t* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const std::int16_t* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const std::uint16_t* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const std::int32_t* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const std::uint32_t* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const std::int64_t* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const std::uint64_t* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const float* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::write(const double* data, std::size_t count)
+{
+    return writeArray(data, count);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readVarUInt(std::uint64_t& data)
+{
+    // Gather 7 bits per byte until a byte without the continuation bit, 10 bytes at most
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; (i < 10) && checkSize(i + 1); ++i)
+    {
+        const auto byte = static_cast<std::uint8_t>(m_data[m_readPos + i]);
+
+        // The 10th byte only holds the highest bit of the value
+        if ((i == 9) && (byte > 0x01))
+            break;
+
+        value |= std::uint64_t{byte & 0x7Fu} << (7 * i);
+
+        if ((byte & 0x80) == 0)
+        {
+            data = value;
+            m_readPos += i + 1;
+            return *this;
+        }
+    }
+
+    // The value is either truncated, too long or doesn't fit in 64 bits
+    m_isValid = false;
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readVarInt(std::int64_t& data)
+{
+    std::uint64_t value = 0;
+    if (readVarUInt(value))
+        data = static_cast<std::int64_t>((value >> 1) ^ (std::uint64_t{0} - (value & 1)));
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeVarUInt(std::uint64_t data)
+{
+    // Store 7 bits per byte, the highest bit tells whether more bytes follow
+    std::array<std::uint8_t, 10> bytes{};
+    std::size_t                  size = 0;
+    while (data >= 0x80)
+    {
+        bytes[size++] = static_cast<std::uint8_t>((data & 0x7F) | 0x80);
+        data >>= 7;
+    }
+    bytes[size++] = static_cast<std::uint8_t>(data);
+
+    append(bytes.data(), size);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeVarInt(std::int64_t data)
+{
+    // Zigzag encoding moves the sign to the lowest bit, so that small negative values stay small
+    const auto value = static_cast<std::uint64_t>(data);
+    return writeVarUInt((value << 1) ^ (data < 0 ? std::numeric_limits<std::uint64_t>::max() : 0));
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readQuantized(float& data, float min, float max, unsigned int bits)
+{
+    assert((bits >= 1) && (bits <= 32) && "Packet::readQuantized Bits must be in [1, 32]");
+    assert((min < max) && "Packet::readQuantized Min must be lower than max");
+
+    const std::size_t size = (bits + 7) / 8;
+    if (checkSize(size))
+    {
+        // The steps are stored in network byte order (big endian)
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < size; ++i)
+            value = (value << 8) | static_cast<std::uint8_t>(m_data[m_readPos + i]);
+
+        const std::uint64_t steps = (std::uint64_t{1} << bits) - 1;
+        const double        range = static_cast<double>(max) - static_cast<double>(min);
+        const double        ratio = static_cast<double>(std::min(value, steps)) / static_cast<double>(steps);
+        data                      = static_cast<float>(static_cast<double>(min) + range * ratio);
+
+        m_readPos += size;
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeQuantized(float data, float min, float max, unsigned int bits)
+{
+    assert((bits >= 1) && (bits <= 32) && "Packet::writeQuantized Bits must be in [1, 32]");
+    assert((min < max) && "Packet::writeQuantized Min must be lower than max");
+
+    // Map the clamped value (NaN included) to the closest step
+    const float         clamped = (data > min) ? std::min(data, max) : min;
+    const double        range   = static_cast<double>(max) - static_cast<double>(min);
+    const double        ratio   = (static_cast<double>(clamped) - static_cast<double>(min)) / range;
+    const std::uint64_t steps   = (std::uint64_t{1} << bits) - 1;
+    const auto          value   = static_cast<std::uint64_t>(std::llround(ratio * static_cast<double>(steps)));
+
+    // Store the steps in network byte order (big endian)
+    const std::size_t           size = (bits + 7) / 8;
+    std::array<std::uint8_t, 4> bytes{};
+    for (std::size_t i = 0; i < size; ++i)
+        bytes[i] = static_cast<std::uint8_t>(value >> (8 * (size - 1 - i)));
+
+    append(bytes.data(), size);
+    return *this;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Packet::checkSize(std::size_t size)
 {
-    m_isValid = m_isValid && (m_readPos + size <= m_data.size());
+    m_isValid = m_isValid && (size <= m_data.size() - m_readPos);
 
     return m_isValid;
 }
@@ -54,7 +54,8 @@ Socket::~Socket()
 Socket::Socket(Socket&& socket) noexcept :
 m_type(socket.m_type),
 m_socket(std::exchange(socket.m_socket, priv::SocketImpl::invalidSocket())),
-m_isBlocking(socket.m_isBlocking)
+m_isBlocking(socket.m_isBlocking),
+m_hasBufferedData(std::exchange(socket.m_hasBufferedData, false))
 {
 }
 
@@ -67,9 +68,10 @@ Socket& Socket::operator=(Socket&& socket) noexcept
 
     close();
 
-    m_type       = socket.m_type;
-    m_socket     = std::exchange(socket.m_socket, priv::SocketImpl::invalidSocket());
-    m_isBlocking = socket.m_isBlocking;
+    m_type            = socket.m_type;
+    m_socket          = std::exchange(socket.m_socket, priv::SocketImpl::invalidSocket());
+    m_isBlocking      = socket.m_isBlocking;
+    m_hasBufferedData = std::exchange(socket.m_hasBufferedData, false);
     return *this;
 }
 
@@ -167,9 +169,19 @@ void Socket::close()
     // Close the socket
     if (m_socket != priv::SocketImpl::invalidSocket())
     {
+        // The data buffered for the old connection can't be extracted anymore
+        m_hasBufferedData = false;
+
         priv::SocketImpl::close(m_socket);
         m_socket = priv::SocketImpl::invalidSocket();
     }
 }
 
+
+////////////////////////////////////////////////////////////
+void Socket::setBufferedData(bool buffered)
+{
+    m_hasBufferedData = buffered;
+}
+
 } // namespace sf
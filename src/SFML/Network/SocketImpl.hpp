@@ -45,12 +45,12 @@
 #include <netinet/tcp.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
-#include <cstddef>
-
 #endif
 
+#include <cstddef>
 #include <cstdint>
 
 
@@ -75,6 +75,16 @@ public:
     using Size       = std::size_t;
 #endif
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Contiguous block of bytes to send
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ConstBuffer
+    {
+        const void* data{}; //!< Pointer to the first byte
+        std::size_t size{}; //!< Number of bytes
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Create an internal sockaddr_in address
     ///
@@ -111,6 +121,38 @@ public:
     ////////////////////////////////////////////////////////////
     static void setBlocking(SocketHandle sock, bool block);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether data can be received without blocking
+    ///
+    /// \param sock Handle of the socket
+    ///
+    /// \return `true` if a receive would return immediately
+    ///
+    ////////////////////////////////////////////////////////////
+    static bool isReadable(SocketHandle sock);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several buffers in a single system call
+    ///
+    /// The buffers are sent back to back, as if they were
+    /// a single contiguous block. Like `send`, this function
+    /// may send fewer bytes than requested.
+    ///
+    /// \param sock    Handle of the socket
+    /// \param buffers Array of buffers to send
+    /// \param count   Number of buffers in the array
+    /// \param offset  Number of bytes to skip at the start of the first buffer
+    /// \param flags   Flags passed to the system call
+    ///
+    /// \return Number of bytes sent, or -1 on error
+    ///
+    ////////////////////////////////////////////////////////////
+    static std::int64_t sendBuffers(SocketHandle       sock,
+                                    const ConstBuffer* buffers,
+                                    std::size_t        count,
+                                    std::size_t        offset,
+                                    int                flags);
+
     ////////////////////////////////////////////////////////////
     /// Get the last socket error status
     ///
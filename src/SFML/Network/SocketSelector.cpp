@@ -32,178 +32,462 @@
 #include <SFML/System/Err.hpp>
 
 #include <algorithm>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <ostream>
+#include <unordered_map>
 #include <utility>
+#include <vector>
+
+#include <cerrno>
+
+// epoll reports only the ready sockets and has no limit on the handles, poll is the portable
+// fallback without limit, and Windows keeps select (WSAPoll is not available on all supported versions)
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+#include <sys/epoll.h>
+#define SFML_SOCKETSELECTOR_EPOLL
+#elif !defined(SFML_SYSTEM_WINDOWS)
+#include <poll.h>
+#define SFML_SOCKETSELECTOR_POLL
+#endif
 
 #ifdef _MSC_VER
 #pragma warning(disable : 4127) // "conditional expression is constant" generated by the FD_SET macro
 #endif
 
 
+namespace
+{
+// Convert a timeout to milliseconds, rounded up so that short timeouts still wait, -1 meaning infinite
+[[maybe_unused]] int toMilliseconds(const std::optional<sf::Time>& timeout)
+{
+    if (!timeout)
+        return -1;
+
+    const std::int64_t milliseconds = (timeout->asMicroseconds() + 999) / 1000;
+    return static_cast<int>(std::clamp<std::int64_t>(milliseconds, 0, std::numeric_limits<int>::max()));
+}
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
 struct SocketSelector::SocketSelectorImpl
 {
+    SocketSelectorImpl();
+    ~SocketSelectorImpl();
+    SocketSelectorImpl(const SocketSelectorImpl& copy);
+    SocketSelectorImpl& operator=(const SocketSelectorImpl&) = delete;
+
+    [[nodiscard]] bool registerHandle(SocketHandle handle);
+    void               unregisterHandle(SocketHandle handle);
+    void               unregisterAll();
+    void               waitHandles(const std::optional<Time>& timeout);
+    void               setReady(SocketHandle handle);
+    void               resetReady();
+
+    struct Entry
+    {
+        Socket* socket{}; //!< Socket that was added with this handle
+        bool    ready{};  //!< Was the socket ready after the last wait?
+#ifdef SFML_SOCKETSELECTOR_POLL
+        std::size_t position{}; //!< Position of the handle in the poll descriptors
+#endif
+    };
+
+    std::unordered_map<SocketHandle, Entry> entries;      //!< Sockets of the selector, by handle
+    std::vector<SocketHandle>               readyHandles; //!< Handles of the sockets that are ready
+    std::vector<Socket*>                    readySockets; //!< Sockets that are ready
+
+#if defined(SFML_SOCKETSELECTOR_EPOLL)
+    int                      epoll{-1}; //!< Handle of the epoll instance
+    std::vector<epoll_event> events;    //!< Events filled by epoll_wait
+#elif defined(SFML_SOCKETSELECTOR_POLL)
+    std::vector<pollfd> descriptors; //!< Descriptors passed to poll
+#else
     fd_set allSockets{};   //!< Set containing all the sockets handles
     fd_set socketsReady{}; //!< Set containing handles of the sockets that are ready
-    int    maxSocket{};    //!< Maximum socket handle
-    int    socketCount{};  //!< Number of socket handles
+#endif
 };
 
 
+#if defined(SFML_SOCKETSELECTOR_EPOLL)
+
 ////////////////////////////////////////////////////////////
-SocketSelector::SocketSelector() : m_impl(std::make_unique<SocketSelectorImpl>())
+SocketSelector::SocketSelectorImpl::SocketSelectorImpl() : epoll(epoll_create1(EPOLL_CLOEXEC))
 {
-    clear();
+    if (epoll < 0)
+        err() << "Failed to create the epoll instance of the socket selector" << std::endl;
 }
 
 
 ////////////////////////////////////////////////////////////
-SocketSelector::~SocketSelector() = default;
+SocketSelector::SocketSelectorImpl::~SocketSelectorImpl()
+{
+    if (epoll >= 0)
+        ::close(epoll);
+}
 
 
 ////////////////////////////////////////////////////////////
-SocketSelector::SocketSelector(const SocketSelector& copy) : m_impl(std::make_unique<SocketSelectorImpl>(*copy.m_impl))
+SocketSelector::SocketSelectorImpl::SocketSelectorImpl(const SocketSelectorImpl& copy) : SocketSelectorImpl()
 {
+    // The epoll instance can't be shared, register the sockets to a new one
+    for (const auto& [handle, entry] : copy.entries)
+    {
+        if (registerHandle(handle))
+            entries[handle].socket = entry.socket;
+    }
+
+    for (const SocketHandle handle : copy.readyHandles)
+        setReady(handle);
 }
 
 
 ////////////////////////////////////////////////////////////
-SocketSelector& SocketSelector::operator=(const SocketSelector& right)
+bool SocketSelector::SocketSelectorImpl::registerHandle(SocketHandle handle)
 {
-    SocketSelector temp(right);
-    std::swap(m_impl, temp.m_impl);
-    return *this;
+    epoll_event event{};
+    event.events  = EPOLLIN;
+    event.data.fd = handle;
+
+    // The handle may already be registered if its socket was moved and added again
+    if ((epoll_ctl(epoll, EPOLL_CTL_ADD, handle, &event) < 0) && (errno != EEXIST))
+    {
+        err() << "The socket can't be added to the selector, epoll_ctl failed" << std::endl;
+        return false;
+    }
+
+    return true;
 }
 
 
 ////////////////////////////////////////////////////////////
-SocketSelector::SocketSelector(SocketSelector&&) noexcept = default;
+void SocketSelector::SocketSelectorImpl::unregisterHandle(SocketHandle handle)
+{
+    // Closed sockets are removed automatically, the error can be ignored
+    epoll_event event{};
+    epoll_ctl(epoll, EPOLL_CTL_DEL, handle, &event);
+}
 
 
-////////////////////////////////////////////////////////////]
-SocketSelector& SocketSelector::operator=(SocketSelector&&) noexcept = default;
+////////////////////////////////////////////////////////////
+void SocketSelector::SocketSelectorImpl::unregisterAll()
+{
+    for (const auto& [handle, entry] : entries)
+        unregisterHandle(handle);
+}
 
 
 ////////////////////////////////////////////////////////////
-void SocketSelector::add(Socket& socket)
+void SocketSelector::SocketSelectorImpl::waitHandles(const std::optional<Time>& timeout)
 {
-    const SocketHandle handle = socket.getNativeHandle();
-    if (handle != priv::SocketImpl::invalidSocket())
-    {
+    // Make room for all the sockets to be reported at once, like select does
+    events.resize(std::max(entries.size(), std::size_t{1}));
 
-#if defined(SFML_SYSTEM_WINDOWS)
+    const int count = epoll_wait(epoll, events.data(), static_cast<int>(events.size()), toMilliseconds(timeout));
 
-        if (m_impl->socketCount >= FD_SETSIZE)
-        {
-            err() << "The socket can't be added to the selector because the "
-                  << "selector is full. This is a limitation of your operating "
-                  << "system's FD_SETSIZE setting.";
-            return;
-        }
+    // Only the ready sockets are visited
+    for (int i = 0; i < count; ++i)
+        setReady(events[static_cast<std::size_t>(i)].data.fd);
+}
 
-        if (FD_ISSET(handle, &m_impl->allSockets))
-            return;
+#elif defined(SFML_SOCKETSELECTOR_POLL)
 
-        ++m_impl->socketCount;
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelectorImpl::SocketSelectorImpl() = default;
 
-#else
 
-        if (handle >= FD_SETSIZE)
-        {
-            err() << "The socket can't be added to the selector because its "
-                  << "ID is too high. This is a limitation of your operating "
-                  << "system's FD_SETSIZE setting.";
-            return;
-        }
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelectorImpl::~SocketSelectorImpl() = default;
 
-        // SocketHandle is an int in POSIX
-        m_impl->maxSocket = std::max(m_impl->maxSocket, handle);
 
-#endif
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelectorImpl::SocketSelectorImpl(const SocketSelectorImpl& copy) = default;
+
 
-        FD_SET(handle, &m_impl->allSockets);
+////////////////////////////////////////////////////////////
+bool SocketSelector::SocketSelectorImpl::registerHandle(SocketHandle handle)
+{
+    if (entries.find(handle) == entries.end())
+    {
+        entries[handle].position = descriptors.size();
+        descriptors.push_back({handle, POLLIN, 0});
     }
+
+    return true;
 }
 
 
 ////////////////////////////////////////////////////////////
-void SocketSelector::remove(Socket& socket)
+void SocketSelector::SocketSelectorImpl::unregisterHandle(SocketHandle handle)
 {
-    const SocketHandle handle = socket.getNativeHandle();
-    if (handle != priv::SocketImpl::invalidSocket())
-    {
+    // Move the last descriptor to the position of the removed one
+    const std::size_t position = entries[handle].position;
+    descriptors[position]      = descriptors.back();
+    descriptors.pop_back();
 
-#if defined(SFML_SYSTEM_WINDOWS)
+    if (position < descriptors.size())
+        entries[descriptors[position].fd].position = position;
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketSelector::SocketSelectorImpl::unregisterAll()
+{
+    descriptors.clear();
+}
 
-        if (!FD_ISSET(handle, &m_impl->allSockets))
-            return;
 
-        --m_impl->socketCount;
+////////////////////////////////////////////////////////////
+void SocketSelector::SocketSelectorImpl::waitHandles(const std::optional<Time>& timeout)
+{
+    int count = ::poll(descriptors.data(), static_cast<nfds_t>(descriptors.size()), toMilliseconds(timeout));
+
+    // Errors and hang-ups are reported as readable, receiving will tell what happened
+    for (std::size_t i = 0; (i < descriptors.size()) && (count > 0); ++i)
+    {
+        if (descriptors[i].revents & (POLLIN | POLLHUP | POLLERR))
+        {
+            setReady(descriptors[i].fd);
+            --count;
+        }
+    }
+}
 
 #else
 
-        if (handle >= FD_SETSIZE)
-            return;
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelectorImpl::SocketSelectorImpl()
+{
+    FD_ZERO(&allSockets);
+    FD_ZERO(&socketsReady);
+}
+
+
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelectorImpl::~SocketSelectorImpl() = default;
+
+
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelectorImpl::SocketSelectorImpl(const SocketSelectorImpl& copy) = default;
 
-#endif
 
-        FD_CLR(handle, &m_impl->allSockets);
-        FD_CLR(handle, &m_impl->socketsReady);
+////////////////////////////////////////////////////////////
+bool SocketSelector::SocketSelectorImpl::registerHandle(SocketHandle handle)
+{
+    if (FD_ISSET(handle, &allSockets))
+        return true;
+
+    if (entries.size() >= static_cast<std::size_t>(FD_SETSIZE))
+    {
+        err() << "The socket can't be added to the selector because the "
+              << "selector is full. This is a limitation of your operating "
+              << "system's FD_SETSIZE setting.";
+        return false;
     }
+
+    FD_SET(handle, &allSockets);
+    return true;
 }
 
 
 ////////////////////////////////////////////////////////////
-void SocketSelector::clear()
+void SocketSelector::SocketSelectorImpl::unregisterHandle(SocketHandle handle)
 {
-    FD_ZERO(&m_impl->allSockets);
-    FD_ZERO(&m_impl->socketsReady);
+    FD_CLR(handle, &allSockets);
+}
+
 
-    m_impl->maxSocket   = 0;
-    m_impl->socketCount = 0;
+////////////////////////////////////////////////////////////
+void SocketSelector::SocketSelectorImpl::unregisterAll()
+{
+    FD_ZERO(&allSockets);
 }
 
 
 ////////////////////////////////////////////////////////////
-bool SocketSelector::wait(Time timeout)
+void SocketSelector::SocketSelectorImpl::waitHandles(const std::optional<Time>& timeout)
 {
     // Setup the timeout
     timeval time{};
-    time.tv_sec  = static_cast<long>(timeout.asMicroseconds() / 1000000);
-    time.tv_usec = static_cast<int>(timeout.asMicroseconds() % 1000000);
+    if (timeout)
+    {
+        time.tv_sec  = static_cast<long>(timeout->asMicroseconds() / 1000000);
+        time.tv_usec = static_cast<int>(timeout->asMicroseconds() % 1000000);
+    }
 
     // Initialize the set that will contain the sockets that are ready
-    m_impl->socketsReady = m_impl->allSockets;
+    socketsReady = allSockets;
 
     // Wait until one of the sockets is ready for reading, or timeout is reached
     // The first parameter is ignored on Windows
-    const int count = select(m_impl->maxSocket + 1, &m_impl->socketsReady, nullptr, nullptr, timeout != Time::Zero ? &time : nullptr);
+    const int count = select(0, &socketsReady, nullptr, nullptr, timeout ? &time : nullptr);
 
-    return count > 0;
+    // On Windows, the set is an array that only contains the ready sockets after select returns
+    for (u_int i = 0; (count > 0) && (i < socketsReady.fd_count); ++i)
+        setReady(socketsReady.fd_array[i]);
 }
 
+#endif
+
 
 ////////////////////////////////////////////////////////////
-bool SocketSelector::isReady(Socket& socket) const
+void SocketSelector::SocketSelectorImpl::setReady(SocketHandle handle)
+{
+    const auto it = entries.find(handle);
+    if ((it != entries.end()) && !it->second.ready)
+    {
+        it->second.ready = true;
+        readyHandles.push_back(handle);
+        readySockets.push_back(it->second.socket);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketSelector::SocketSelectorImpl::resetReady()
+{
+    for (const SocketHandle handle : readyHandles)
+    {
+        const auto it = entries.find(handle);
+        if (it != entries.end())
+            it->second.ready = false;
+    }
+
+    readyHandles.clear();
+    readySockets.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelector() : m_impl(std::make_unique<SocketSelectorImpl>())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+SocketSelector::~SocketSelector() = default;
+
+
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelector(const SocketSelector& copy) : m_impl(std::make_unique<SocketSelectorImpl>(*copy.m_impl))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+SocketSelector& SocketSelector::operator=(const SocketSelector& right)
+{
+    SocketSelector temp(right);
+    std::swap(m_impl, temp.m_impl);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+SocketSelector::SocketSelector(SocketSelector&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+SocketSelector& SocketSelector::operator=(SocketSelector&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+void SocketSelector::add(Socket& socket)
 {
     const SocketHandle handle = socket.getNativeHandle();
     if (handle != priv::SocketImpl::invalidSocket())
     {
+        if (!m_impl->registerHandle(handle))
+            return;
 
-#if !defined(SFML_SYSTEM_WINDOWS)
+        // Adding a socket again updates its address, in case it was moved
+        const auto [it, inserted] = m_impl->entries.try_emplace(handle);
+        if (!inserted && it->second.ready)
+            std::replace(m_impl->readySockets.begin(), m_impl->readySockets.end(), it->second.socket, &socket);
 
-        if (handle >= FD_SETSIZE)
-            return false;
+        it->second.socket = &socket;
+    }
+}
 
-#endif
 
-        return FD_ISSET(handle, &m_impl->socketsReady) != 0;
+////////////////////////////////////////////////////////////
+void SocketSelector::remove(Socket& socket)
+{
+    const SocketHandle handle = socket.getNativeHandle();
+    if (handle != priv::SocketImpl::invalidSocket())
+    {
+        const auto it = m_impl->entries.find(handle);
+        if (it == m_impl->entries.end())
+            return;
+
+        if (it->second.ready)
+        {
+            auto& readyHandles = m_impl->readyHandles;
+            auto& readySockets = m_impl->readySockets;
+            readyHandles.erase(std::find(readyHandles.begin(), readyHandles.end(), handle));
+            readySockets.erase(std::find(readySockets.begin(), readySockets.end(), it->second.socket));
+        }
+
+        m_impl->unregisterHandle(handle);
+        m_impl->entries.erase(handle);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SocketSelector::clear()
+{
+    m_impl->unregisterAll();
+    m_impl->entries.clear();
+    m_impl->readyHandles.clear();
+    m_impl->readySockets.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketSelector::wait(Time timeout)
+{
+    m_impl->resetReady();
+
+    // Packets already buffered by the sockets don't wake the system up, so report them without waiting
+    for (const auto& [handle, entry] : m_impl->entries)
+    {
+        if (entry.socket->m_hasBufferedData)
+            m_impl->setReady(handle);
+    }
+
+    // Still look for sockets ready on the system side, without blocking if some are already ready
+    if (!m_impl->readySockets.empty())
+        m_impl->waitHandles(Time::Zero);
+    else
+        m_impl->waitHandles(timeout != Time::Zero ? std::optional(timeout) : std::nullopt);
+
+    return !m_impl->readySockets.empty();
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketSelector::isReady(Socket& socket) const
+{
+    const SocketHandle handle = socket.getNativeHandle();
+    if (handle != priv::SocketImpl::invalidSocket())
+    {
+        const auto it = m_impl->entries.find(handle);
+        return (it != m_impl->entries.end()) && it->second.ready;
     }
 
     return false;
 }
 
+
+////////////////////////////////////////////////////////////
+const std::vector<Socket*>& SocketSelector::getReadySockets() const
+{
+    return m_impl->readySockets;
+}
+
 } // namespace sf
@@ -51,6 +51,95 @@ constexpr int flags = MSG_NOSIGNAL;
 #else
 constexpr int flags = 0;
 #endif
+
+// Maximum number of packets handed to the system in a single call
+constexpr std::size_t maxPacketsPerCall = 128;
+
+// Default size of the buffer receiving the incoming bytes
+constexpr std::size_t receiveBufferSize = 64 * 1024;
+
+// Size of the prefix holding the size of each packet in the stream
+constexpr std::size_t packetSizeLength = sizeof(std::uint32_t);
+
+// Largest packet accepted from the network, so that a bogus size prefix can't exhaust the memory
+constexpr std::uint32_t maxPacketSize = 1024 * 1024 * 1024;
+
+// Read the size prefix of a packet, stored in network byte order
+std::uint32_t readPacketSize(const std::byte* data)
+{
+    std::uint32_t size = 0;
+    std::memcpy(&size, data, sizeof(size));
+    return ntohl(size);
+}
+
+// Receive bytes from the network
+sf::Socket::Status receiveBytes(sf::SocketHandle handle, void* data, std::size_t size, std::size_t& received)
+{
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuseless-cast"
+    // Receive a chunk of bytes
+    const int sizeReceived = static_cast<int>(
+        recv(handle, static_cast<char*>(data), static_cast<sf::priv::SocketImpl::Size>(size), flags));
+#pragma GCC diagnostic pop
+
+    // Check the number of bytes received
+    if (sizeReceived > 0)
+    {
+        received = static_cast<std::size_t>(sizeReceived);
+        return sf::Socket::Status::Done;
+    }
+    if (sizeReceived == 0)
+    {
+        return sf::Socket::Status::Disconnected;
+    }
+
+    return sf::priv::SocketImpl::getErrorStatus();
+}
+
+// Send a list of buffers, skipping the first `position` bytes which were already sent
+sf::Socket::Status sendBuffers(sf::SocketHandle                         handle,
+                               const sf::priv::SocketImpl::ConstBuffer* buffers,
+                               std::size_t                              count,
+                               std::size_t&                             position)
+{
+    // Skip the buffers which were completely sent by a previous call
+    std::size_t index  = 0;
+    std::size_t offset = position;
+    while ((index < count) && (offset >= buffers[index].size))
+        offset -= buffers[index++].size;
+
+    // Loop until every buffer has been sent
+    bool progress = false;
+    while (index < count)
+    {
+        // Send the remaining buffers, starting from the unsent part of the first one
+        const std::int64_t result = sf::priv::SocketImpl::sendBuffers(handle,
+                                                                      buffers + index,
+                                                                      count - index,
+                                                                      offset,
+                                                                      flags);
+
+        // Check for errors
+        if (result < 0)
+        {
+            const sf::Socket::Status status = sf::priv::SocketImpl::getErrorStatus();
+
+            if ((status == sf::Socket::Status::NotReady) && progress)
+                return sf::Socket::Status::Partial;
+
+            return status;
+        }
+
+        // Advance past the bytes which were sent
+        progress = progress || (result > 0);
+        position += static_cast<std::size_t>(result);
+        offset += static_cast<std::size_t>(result);
+        while ((index < count) && (offset >= buffers[index].size))
+            offset -= buffers[index++].size;
+    }
+
+    return sf::Socket::Status::Done;
+}
 } // namespace
 
 namespace sf
@@ -215,8 +304,8 @@ void TcpSocket::disconnect()
     // Close the socket
     close();
 
-    // Reset the pending packet data
-    m_pendingPacket = PendingPacket();
+    // Discard the bytes received from the previous connection
+    m_receiveBuffer = ReceiveBuffer();
 }
 
 
@@ -284,146 +373,225 @@ Socket::Status TcpSocket::receive(void* data, std::size_t size, std::size_t& rec
         return Status::Error;
     }
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wuseless-cast"
-    // Receive a chunk of bytes
-    const int sizeReceived = static_cast<int>(
-        recv(getNativeHandle(), static_cast<char*>(data), static_cast<priv::SocketImpl::Size>(size), flags));
-#pragma GCC diagnostic pop
-
-    // Check the number of bytes received
-    if (sizeReceived > 0)
+    // Return the bytes which were already read by a packet receive first
+    ReceiveBuffer& buffer = m_receiveBuffer;
+    if (buffer.begin < buffer.end)
     {
-        received = static_cast<std::size_t>(sizeReceived);
+        received = std::min(size, buffer.end - buffer.begin);
+        std::memcpy(data, buffer.data.data() + buffer.begin, received);
+        buffer.begin += received;
+        setBufferedData(hasPendingPacket());
         return Status::Done;
     }
-    if (sizeReceived == 0)
-    {
-        return Socket::Status::Disconnected;
-    }
 
-    return priv::SocketImpl::getErrorStatus();
+    return receiveBytes(getNativeHandle(), data, size, received);
 }
 
 
 ////////////////////////////////////////////////////////////
 Socket::Status TcpSocket::send(Packet& packet)
+{
+    std::size_t sent = 0;
+    return send(&packet, 1, sent);
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpSocket::send(Packet* packets, std::size_t count, std::size_t& sent)
 {
     // TCP is a stream protocol, it doesn't preserve messages boundaries.
     // This means that we have to send the packet size first, so that the
     // receiver knows the actual end of the packet in the data stream.
 
-    // We allocate an extra memory block so that the size can be sent
-    // together with the data in a single call. This may seem inefficient,
-    // but it is actually required to avoid partial send, which could cause
-    // data corruption on the receiving end.
+    // The sizes and the packet data are handed to the system as a list of
+    // buffers, so that they are sent together in a single call without
+    // copying the data into an intermediate block first. Sending them
+    // together is required to avoid partial sends of the size alone,
+    // which could cause data corruption on the receiving end.
 
-    // Get the data to send from the packet
-    std::size_t size = 0;
-    const void* data = packet.onSend(size);
+    sent = 0;
 
-    // First convert the packet size to network byte order
-    std::uint32_t packetSize = htonl(static_cast<std::uint32_t>(size));
+    // Check the parameters
+    if (!packets || (count == 0))
+    {
+        err() << "Cannot send packets over the network (no packets to send)" << std::endl;
+        return Status::Error;
+    }
 
-    // Allocate memory for the data block to send
-    m_blockToSendBuffer.resize(sizeof(packetSize) + size);
+    std::array<std::uint32_t, maxPacketsPerCall>                    sizes{};
+    std::array<priv::SocketImpl::ConstBuffer, maxPacketsPerCall * 2> buffers{};
+    bool                                                             progress = false;
 
-// Copy the packet size and data into the block to send
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wnull-dereference" // False positive.
-    std::memcpy(m_blockToSendBuffer.data(), &packetSize, sizeof(packetSize));
-#pragma GCC diagnostic pop
-    if (size > 0)
-        std::memcpy(m_blockToSendBuffer.data() + sizeof(packetSize), data, size);
+    while (sent < count)
+    {
+        // Gather the sizes and data of the next packets, converting the sizes to network byte order
+        const std::size_t batchSize   = std::min(count - sent, maxPacketsPerCall);
+        std::size_t       bufferCount = 0;
+        for (std::size_t i = 0; i < batchSize; ++i)
+        {
+            std::size_t size = 0;
+            const void* data = packets[sent + i].onSend(size);
 
-// These warnings are ignored here for portability, as even on Windows the
-// signature of `send` might change depending on whether Win32 or MinGW is
-// being used.
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wuseless-cast"
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wsign-conversion"
-    // Send the data block
-    std::size_t  sent   = 0;
-    const Status status = send(m_blockToSendBuffer.data() + packet.m_sendPos,
-                               static_cast<priv::SocketImpl::Size>(m_blockToSendBuffer.size() - packet.m_sendPos),
-                               sent);
-#pragma GCC diagnostic pop
-#pragma GCC diagnostic pop
+            sizes[i]               = htonl(static_cast<std::uint32_t>(size));
+            buffers[bufferCount++] = {&sizes[i], sizeof(sizes[i])};
+            if (size > 0)
+                buffers[bufferCount++] = {data, size};
+        }
 
-    // In the case of a partial send, record the location to resume from
-    if (status == Status::Partial)
-    {
-        packet.m_sendPos += sent;
-    }
-    else if (status == Status::Done)
-    {
-        packet.m_sendPos = 0;
+        // Send the buffers, resuming where a previous partial send stopped
+        std::size_t  position = packets[sent].m_sendPos;
+        const Status status   = sendBuffers(getNativeHandle(), buffers.data(), bufferCount, position);
+
+        // Record which packets were completely sent and where to resume from
+        for (std::size_t i = 0; i < batchSize; ++i)
+        {
+            const std::size_t packetSize = sizeof(sizes[i]) + ntohl(sizes[i]);
+            if (position < packetSize)
+            {
+                packets[sent].m_sendPos = position;
+                break;
+            }
+
+            packets[sent].m_sendPos = 0;
+            position -= packetSize;
+            ++sent;
+        }
+
+        if (status == Status::Partial)
+            return status;
+
+        if (status != Status::Done)
+            return ((status == Status::NotReady) && progress) ? Status::Partial : status;
+
+        progress = true;
     }
 
-    return status;
+    return Status::Done;
 }
 
 
 ////////////////////////////////////////////////////////////
 Socket::Status TcpSocket::receive(Packet& packet)
+{
+    std::size_t received = 0;
+    return receive(&packet, 1, received);
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpSocket::receive(Packet* packets, std::size_t count, std::size_t& received)
 {
     // First clear the variables to fill
-    packet.clear();
+    received = 0;
 
-    // We start by getting the size of the incoming packet
-    std::uint32_t packetSize = 0;
-    std::size_t   received   = 0;
-    if (m_pendingPacket.sizeReceived < sizeof(m_pendingPacket.size))
+    // Check the destination packets
+    if (!packets || (count == 0))
     {
-        // Loop until we've received the entire size of the packet
-        // (even a 4 byte variable may be received in more than one call)
-        while (m_pendingPacket.sizeReceived < sizeof(m_pendingPacket.size))
-        {
-            char*        data   = reinterpret_cast<char*>(&m_pendingPacket.size) + m_pendingPacket.sizeReceived;
-            const Status status = receive(data, sizeof(m_pendingPacket.size) - m_pendingPacket.sizeReceived, received);
-            m_pendingPacket.sizeReceived += received;
+        err() << "Cannot receive packets from the network (no packets to fill)" << std::endl;
+        return Status::Error;
+    }
 
-            if (status != Status::Done)
-                return status;
-        }
+    packets[0].clear();
+
+    // Read from the network until at least one packet is complete
+    while (!hasPendingPacket())
+    {
+        const Status status = fillReceiveBuffer();
+        if (status != Status::Done)
+            return status;
+    }
 
-        // The packet size has been fully received
-        packetSize = ntohl(m_pendingPacket.size);
+    // Hand every complete packet to the user packets, directly from the receive buffer
+    ReceiveBuffer& buffer = m_receiveBuffer;
+    while ((received < count) && hasPendingPacket())
+    {
+        const std::size_t size = readPacketSize(buffer.data.data() + buffer.begin);
+        buffer.begin += packetSizeLength;
+
+        Packet& packet = packets[received++];
+        packet.clear();
+        if (size > 0)
+            packet.onReceive(buffer.data.data() + buffer.begin, size);
+
+        buffer.begin += size;
     }
-    else
+
+    // Release the memory used by a large packet once the buffer is empty
+    if (buffer.begin == buffer.end)
     {
-        // The packet size has already been received in a previous call
-        packetSize = ntohl(m_pendingPacket.size);
+        buffer.begin = 0;
+        buffer.end   = 0;
+
+        if (buffer.data.size() > receiveBufferSize)
+        {
+            buffer.data.resize(receiveBufferSize);
+            buffer.data.shrink_to_fit();
+        }
     }
 
-    // Loop until we receive all the packet data
-    std::array<char, 1024> buffer{};
-    while (m_pendingPacket.data.size() < packetSize)
+    // Let selectors report the packets left in the buffer
+    setBufferedData(hasPendingPacket());
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TcpSocket::hasPendingPacket() const
+{
+    const ReceiveBuffer& buffer   = m_receiveBuffer;
+    const std::size_t    buffered = buffer.end - buffer.begin;
+
+    if (buffered < packetSizeLength)
+        return false;
+
+    return buffered - packetSizeLength >= readPacketSize(buffer.data.data() + buffer.begin);
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpSocket::fillReceiveBuffer()
+{
+    ReceiveBuffer& buffer = m_receiveBuffer;
+
+    // Move the bytes which were not extracted yet to the front, to make room after them
+    if (buffer.begin > 0)
     {
-        // Receive a chunk of data
-        const std::size_t sizeToGet = std::min(packetSize - m_pendingPacket.data.size(), buffer.size());
-        const Status      status    = receive(buffer.data(), sizeToGet, received);
-        if (status != Status::Done)
-            return status;
+        std::memmove(buffer.data.data(), buffer.data.data() + buffer.begin, buffer.end - buffer.begin);
+        buffer.end -= buffer.begin;
+        buffer.begin = 0;
+    }
 
-        // Append it into the packet
-        if (received > 0)
+    // Check the size of the next packet as soon as it is known
+    std::size_t packetSize = 0;
+    if (buffer.end >= packetSizeLength)
+    {
+        const std::uint32_t size = readPacketSize(buffer.data.data());
+        if (size > maxPacketSize)
         {
-            m_pendingPacket.data.resize(m_pendingPacket.data.size() + received);
-            std::byte* begin = m_pendingPacket.data.data() + m_pendingPacket.data.size() - received;
-            std::memcpy(begin, buffer.data(), received);
+            err() << "Cannot receive packet of " << size << " bytes (the limit is " << maxPacketSize << " bytes)"
+                  << std::endl;
+            return Status::Error;
         }
+
+        packetSize = packetSizeLength + size;
     }
 
-    // We have received all the packet data: we can copy it to the user packet
-    if (!m_pendingPacket.data.empty())
-        packet.onReceive(m_pendingPacket.data.data(), m_pendingPacket.data.size());
+    // Grow the buffer only once it is full of the bytes of a larger packet, so that memory follows the data received
+    if (buffer.data.size() < receiveBufferSize)
+        buffer.data.resize(receiveBufferSize);
+    else if ((buffer.end == buffer.data.size()) && (packetSize > buffer.end))
+        buffer.data.resize(std::min(buffer.data.size() * 2, packetSize));
 
-    // Clear the pending packet data
-    m_pendingPacket = PendingPacket();
+    // Receive as many bytes as are available, up to the free space of the buffer
+    std::size_t  received = 0;
+    const Status status   = receiveBytes(getNativeHandle(),
+                                       buffer.data.data() + buffer.end,
+                                       buffer.data.size() - buffer.end,
+                                       received);
+    buffer.end += received;
 
-    return Status::Done;
+    return status;
 }
 
 } // namespace sf
@@ -32,10 +32,23 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
+#include <array>
 #include <ostream>
 
 #include <cstddef>
 
+#if defined(SFML_SYSTEM_LINUX)
+// Linux can send and receive a whole batch of datagrams in a single system call
+#define SFML_UDPSOCKET_MMSG
+#endif
+
+
+namespace
+{
+// Maximum number of datagrams handed to the system in a single call
+[[maybe_unused]] constexpr std::size_t maxDatagramsPerCall = 64;
+} // namespace
 
 namespace sf
 {
@@ -220,4 +233,201 @@ Socket::Status UdpSocket::receive(Packet& packet, std::optional<IpAddress>& remo
 }
 
 
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::send(const OutgoingDatagram* datagrams, std::size_t count, std::size_t& sent)
+{
+    sent = 0;
+
+    // Check the parameters
+    if (!datagrams || (count == 0))
+    {
+        err() << "Cannot send data over the network (no datagrams to send)" << std::endl;
+        return Status::Error;
+    }
+
+    // Make sure that all the data will fit in datagrams, before sending anything
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (datagrams[i].size > MaxDatagramSize)
+        {
+            err() << "Cannot send data over the network "
+                  << "(the number of bytes to send is greater than sf::UdpSocket::MaxDatagramSize)" << std::endl;
+            return Status::Error;
+        }
+    }
+
+    // Create the internal socket if it doesn't exist
+    create();
+
+#ifdef SFML_UDPSOCKET_MMSG
+
+    std::array<mmsghdr, maxDatagramsPerCall>     messages{};
+    std::array<iovec, maxDatagramsPerCall>       vectors{};
+    std::array<sockaddr_in, maxDatagramsPerCall> addresses{};
+
+    while (sent < count)
+    {
+        // Describe the next datagrams
+        const std::size_t batchSize = std::min(count - sent, maxDatagramsPerCall);
+        for (std::size_t i = 0; i < batchSize; ++i)
+        {
+            const OutgoingDatagram& datagram = datagrams[sent + i];
+
+            addresses[i] = priv::SocketImpl::createAddress(datagram.remoteAddress.toInteger(), datagram.remotePort);
+
+            vectors[i].iov_base = const_cast<void*>(datagram.data);
+            vectors[i].iov_len  = datagram.size;
+
+            messages[i].msg_hdr             = msghdr();
+            messages[i].msg_hdr.msg_name    = &addresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(addresses[i]);
+            messages[i].msg_hdr.msg_iov     = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        // Send them, the system may stop before the end of the batch
+        const int result = sendmmsg(getNativeHandle(), messages.data(), static_cast<unsigned int>(batchSize), 0);
+
+        // Check for errors
+        if (result < 0)
+        {
+            const Status status = priv::SocketImpl::getErrorStatus();
+            return ((status == Status::NotReady) && (sent > 0)) ? Status::Partial : status;
+        }
+
+        sent += static_cast<std::size_t>(result);
+    }
+
+#else
+
+    // Send the datagrams one by one
+    for (; sent < count; ++sent)
+    {
+        const OutgoingDatagram& datagram = datagrams[sent];
+
+        const Status status = send(datagram.data, datagram.size, datagram.remoteAddress, datagram.remotePort);
+        if (status != Status::Done)
+            return ((status == Status::NotReady) && (sent > 0)) ? Status::Partial : status;
+    }
+
+#endif
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::receive(IncomingDatagram* datagrams, std::size_t count, std::size_t& received)
+{
+    // First clear the variables to fill
+    received = 0;
+
+    // Check the destination buffers
+    if (!datagrams || (count == 0))
+    {
+        err() << "Cannot receive data from the network (no datagrams to fill)" << std::endl;
+        return Status::Error;
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        IncomingDatagram& datagram = datagrams[i];
+        if (!datagram.data)
+        {
+            err() << "Cannot receive data from the network (the destination buffer is invalid)" << std::endl;
+            return Status::Error;
+        }
+
+        datagram.received      = 0;
+        datagram.remoteAddress = std::nullopt;
+        datagram.remotePort    = 0;
+    }
+
+#ifdef SFML_UDPSOCKET_MMSG
+
+    std::array<mmsghdr, maxDatagramsPerCall>     messages{};
+    std::array<iovec, maxDatagramsPerCall>       vectors{};
+    std::array<sockaddr_in, maxDatagramsPerCall> addresses{};
+
+    while (received < count)
+    {
+        // Describe the next buffers
+        const std::size_t batchSize = std::min(count - received, maxDatagramsPerCall);
+        for (std::size_t i = 0; i < batchSize; ++i)
+        {
+            IncomingDatagram& datagram = datagrams[received + i];
+
+            addresses[i]        = priv::SocketImpl::createAddress(INADDR_ANY, 0);
+            vectors[i].iov_base = datagram.data;
+            vectors[i].iov_len  = datagram.size;
+
+            messages[i].msg_hdr             = msghdr();
+            messages[i].msg_hdr.msg_name    = &addresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(addresses[i]);
+            messages[i].msg_hdr.msg_iov     = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen  = 1;
+        }
+
+        // Wait for the first datagram only, then take the ones which are already queued
+        const int flags  = (received == 0) ? MSG_WAITFORONE : MSG_DONTWAIT;
+        const int result = recvmmsg(getNativeHandle(),
+                                    messages.data(),
+                                    static_cast<unsigned int>(batchSize),
+                                    flags,
+                                    nullptr);
+
+        // Check for errors, failing after the first datagrams only means that no more are queued
+        if (result < 0)
+        {
+            if (received > 0)
+                break;
+
+            return priv::SocketImpl::getErrorStatus();
+        }
+
+        // Fill the sender information
+        for (std::size_t i = 0; i < static_cast<std::size_t>(result); ++i)
+        {
+            IncomingDatagram& datagram = datagrams[received + i];
+
+            datagram.received      = messages[i].msg_len;
+            datagram.remoteAddress = IpAddress(ntohl(addresses[i].sin_addr.s_addr));
+            datagram.remotePort    = ntohs(addresses[i].sin_port);
+        }
+
+        received += static_cast<std::size_t>(result);
+
+        if (static_cast<std::size_t>(result) < batchSize)
+            break;
+    }
+
+#else
+
+    // Receive the first datagram as usual, then only the ones which are already queued
+    for (; received < count; ++received)
+    {
+        if ((received > 0) && !priv::SocketImpl::isReadable(getNativeHandle()))
+            break;
+
+        IncomingDatagram& datagram = datagrams[received];
+
+        const Status status = receive(datagram.data,
+                                      datagram.size,
+                                      datagram.received,
+                                      datagram.remoteAddress,
+                                      datagram.remotePort);
+        if (status != Status::Done)
+        {
+            if (received > 0)
+                break;
+
+            return status;
+        }
+    }
+
+#endif
+
+    return Status::Done;
+}
+
 } // namespace sf
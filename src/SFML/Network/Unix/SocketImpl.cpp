@@ -29,8 +29,11 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
+#include <array>
 #include <fcntl.h>
 #include <ostream>
+#include <poll.h>
 
 #include <cerrno>
 
@@ -84,6 +87,49 @@ void SocketImpl::setBlocking(SocketHandle sock, bool block)
 }
 
 
+////////////////////////////////////////////////////////////
+bool SocketImpl::isReadable(SocketHandle sock)
+{
+    pollfd descriptor{};
+    descriptor.fd     = sock;
+    descriptor.events = POLLIN;
+
+    return (poll(&descriptor, 1, 0) > 0) && (descriptor.revents & POLLIN);
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t SocketImpl::sendBuffers(SocketHandle       sock,
+                                     const ConstBuffer* buffers,
+                                     std::size_t        count,
+                                     std::size_t        offset,
+                                     int                flags)
+{
+    // sendmsg rejects more than IOV_MAX buffers, send the first ones and let the caller resume
+    std::array<iovec, 256> vectors{};
+    count = std::min(count, vectors.size());
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        vectors[i].iov_base = const_cast<void*>(buffers[i].data);
+        vectors[i].iov_len  = buffers[i].size;
+    }
+
+    // Skip the part of the first buffer which was already sent
+    if (count > 0)
+    {
+        vectors[0].iov_base = static_cast<char*>(vectors[0].iov_base) + offset;
+        vectors[0].iov_len -= offset;
+    }
+
+    msghdr message{};
+    message.msg_iov    = vectors.data();
+    message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(count);
+
+    return static_cast<std::int64_t>(sendmsg(sock, &message, flags));
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status SocketImpl::getErrorStatus()
 {
@@ -27,6 +27,9 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/SocketImpl.hpp>
 
+#include <algorithm>
+#include <array>
+
 #include <cstdint>
 
 
@@ -66,6 +69,52 @@ void SocketImpl::setBlocking(SocketHandle sock, bool block)
 }
 
 
+////////////////////////////////////////////////////////////
+bool SocketImpl::isReadable(SocketHandle sock)
+{
+    fd_set descriptors;
+    FD_ZERO(&descriptors);
+    FD_SET(sock, &descriptors);
+
+    // Poll the socket without waiting
+    timeval time{};
+    return select(0, &descriptors, nullptr, nullptr, &time) > 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t SocketImpl::sendBuffers(SocketHandle       sock,
+                                     const ConstBuffer* buffers,
+                                     std::size_t        count,
+                                     std::size_t        offset,
+                                     int                flags)
+{
+    // Send the first buffers only and let the caller resume, to keep the array on the stack
+    std::array<WSABUF, 256> vectors{};
+    count = std::min(count, vectors.size());
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        vectors[i].buf = static_cast<CHAR*>(const_cast<void*>(buffers[i].data));
+        vectors[i].len = static_cast<ULONG>(buffers[i].size);
+    }
+
+    // Skip the part of the first buffer which was already sent
+    if (count > 0)
+    {
+        vectors[0].buf += offset;
+        vectors[0].len -= static_cast<ULONG>(offset);
+    }
+
+    DWORD       sent        = 0;
+    const DWORD bufferCount = static_cast<DWORD>(count);
+    if (WSASend(sock, vectors.data(), bufferCount, &sent, static_cast<DWORD>(flags), nullptr, nullptr) != 0)
+        return -1;
+
+    return static_cast<std::int64_t>(sent);
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status SocketImpl::getErrorStatus()
 {
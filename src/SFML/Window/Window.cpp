@@ -194,7 +194,10 @@ void Window::display()
 {
     // Display the backbuffer on screen
     if (setActive())
+    {
+        onDisplay();
         m_context->display();
+    }
 
     // Limit the framerate if needed
     if (m_frameTimeLimit != Time::Zero)
@@ -205,6 +208,13 @@ void Window::display()
 }
 
 
+////////////////////////////////////////////////////////////
+void Window::onDisplay()
+{
+    // Nothing by default
+}
+
+
 ////////////////////////////////////////////////////////////
 void Window::initialize()
 {
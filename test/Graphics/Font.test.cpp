@@ -1,6 +1,7 @@
 #include <SFML/Graphics/Font.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
 #include <SFML/System/Exception.hpp>
@@ -12,6 +13,31 @@
 #include <WindowUtil.hpp>
 #include <fstream>
 #include <type_traits>
+#include <vector>
+
+#include <cstdint>
+
+namespace
+{
+// Compare the pixels of a glyph in two font textures, where it may be at different places
+bool haveSamePixels(const sf::Image& image, sf::IntRect rect, const sf::Image& expected, sf::IntRect expectedRect)
+{
+    if (rect.size != expectedRect.size)
+        return false;
+
+    for (int y = 0; y < rect.size.y; ++y)
+    {
+        for (int x = 0; x < rect.size.x; ++x)
+        {
+            if (image.getPixel(sf::Vector2u(rect.position + sf::Vector2i(x, y))) !=
+                expected.getPixel(sf::Vector2u(expectedRect.position + sf::Vector2i(x, y))))
+                return false;
+        }
+    }
+
+    return true;
+}
+} // namespace
 
 TEST_CASE("[Graphics] sf::Font", runDisplayTests())
 {
@@ -254,4 +280,223 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
         font.setSmooth(false);
         CHECK(!font.isSmooth());
     }
+
+    SECTION("Set/get maximum texture size")
+    {
+        sf::Font font("Graphics/tuffy.ttf");
+        CHECK(font.getMaximumTextureSize() == 0);
+        font.setMaximumTextureSize(256);
+        CHECK(font.getMaximumTextureSize() == 256);
+    }
+
+    SECTION("Shared atlas")
+    {
+        sf::Font font("Graphics/tuffy.ttf");
+        CHECK(!font.isAtlasShared());
+        CHECK(&font.getTexture(16) != &font.getTexture(32));
+
+        font.setAtlasShared(true);
+        CHECK(font.isAtlasShared());
+        CHECK(&font.getTexture(16) == &font.getTexture(32));
+
+        // Glyphs of different sizes and styles are distinct, but packed in the same texture
+        const sf::Glyph small   = font.getGlyph(U'A', 16, false);
+        const sf::Glyph large   = font.getGlyph(U'A', 32, false);
+        const sf::Glyph bold    = font.getGlyph(U'A', 32, true);
+        const sf::Glyph outline = font.getGlyph(U'A', 32, false, 2.f);
+        CHECK(small.textureRect != large.textureRect);
+        CHECK(large.textureRect != bold.textureRect);
+        CHECK(large.textureRect != outline.textureRect);
+        CHECK(!small.textureRect.findIntersection(large.textureRect));
+        CHECK(small.advance < large.advance);
+        CHECK(font.getGlyph(U'A', 16, false).textureRect == small.textureRect);
+        CHECK(font.getAtlasStatistics(16).glyphCount == 4);
+        CHECK(font.getAtlasStatistics(32).glyphCount == 4);
+
+        font.setAtlasShared(false);
+        CHECK(!font.isAtlasShared());
+        CHECK(font.getAtlasStatistics(32).glyphCount == 0);
+    }
+
+    SECTION("Distance field")
+    {
+        sf::Font font("Graphics/tuffy.ttf");
+        CHECK(!font.isDistanceFieldEnabled());
+
+        font.setDistanceFieldEnabled(true);
+        CHECK(font.isDistanceFieldEnabled());
+        CHECK(&font.getTexture(16) == &font.getTexture(sf::Font::DistanceFieldCharacterSize));
+
+        // Glyphs are rasterized once at the reference size and scaled to the others
+        const sf::Glyph reference = font.getGlyph(U'A', sf::Font::DistanceFieldCharacterSize, false);
+        const sf::Glyph half      = font.getGlyph(U'A', sf::Font::DistanceFieldCharacterSize / 2, false);
+        const sf::Glyph outline   = font.getGlyph(U'A', sf::Font::DistanceFieldCharacterSize / 2, false, 2.f);
+        CHECK(reference.textureRect.size.x > 0);
+        CHECK(half.textureRect == reference.textureRect);
+        CHECK(half.advance == Approx(reference.advance / 2));
+        CHECK(half.bounds.size == Approx(reference.bounds.size / 2.f));
+        CHECK(outline.textureRect == half.textureRect);
+        CHECK(outline.bounds == half.bounds);
+        CHECK(font.getAtlasStatistics(16).glyphCount == 1);
+
+        // The field is below the edge value outside of the glyph, down to 0 at the end of the margin
+        const sf::Image   image  = font.getTexture(16).copyToImage();
+        const sf::IntRect rect   = reference.textureRect;
+        const auto        margin = static_cast<int>(sf::Font::DistanceFieldSpread);
+        CHECK(image.getPixel(sf::Vector2u(rect.position - sf::Vector2i(margin, margin))).a == 0);
+        CHECK(image.getPixel(sf::Vector2u(rect.position + sf::Vector2i(rect.size.x / 2, rect.size.y - 1))).a < 128);
+
+        font.setDistanceFieldEnabled(false);
+        CHECK(!font.isDistanceFieldEnabled());
+        const sf::Glyph coverage = font.getGlyph(U'A', sf::Font::DistanceFieldCharacterSize / 2, false);
+        CHECK(coverage.textureRect != reference.textureRect);
+    }
+
+    SECTION("preload()")
+    {
+        SECTION("No font")
+        {
+            sf::Font font;
+            CHECK(font.preload({{U'a', U'z'}}, {16}) == 0);
+        }
+
+        SECTION("Successful load")
+        {
+            sf::Font font("Graphics/tuffy.ttf");
+            CHECK(font.preload({{U'a', U'z'}, {U'A', U'Z'}}, {16, 32}, {{false, 0.f}, {true, 0.f}, {false, 1.f}}) ==
+                  52 * 2 * 3);
+            CHECK(font.getAtlasStatistics(16).glyphCount == 52 * 3);
+            CHECK(font.getAtlasStatistics(32).glyphCount == 52 * 3);
+
+            // Loaded glyphs are skipped
+            CHECK(font.preload({{U'a', U'z'}}, {16}) == 0);
+            CHECK(font.preload({{U'a', U'z'}}, {16}, {{true, 2.f}}) == 26);
+
+            // Preloaded glyphs match the ones loaded on demand
+            const sf::Font   reference("Graphics/tuffy.ttf");
+            const sf::Glyph& glyph         = font.getGlyph(U'g', 32, true);
+            const sf::Glyph& expectedGlyph = reference.getGlyph(U'g', 32, true);
+            CHECK(glyph.advance == expectedGlyph.advance);
+            CHECK(glyph.bounds == expectedGlyph.bounds);
+            CHECK(glyph.textureRect.size == expectedGlyph.textureRect.size);
+            CHECK(font.getAtlasStatistics(32).glyphCount == 52 * 3);
+        }
+
+        SECTION("Same texture as glyphs loaded on demand")
+        {
+            // The glyphs are packed in the same order, only their upload is batched
+            sf::Font font("Graphics/tuffy.ttf");
+            CHECK(font.preload({{U'a', U'z'}}, {32}) == 26);
+
+            const sf::Font reference("Graphics/tuffy.ttf");
+            for (std::uint32_t codePoint = U'a'; codePoint <= U'z'; ++codePoint)
+                (void)reference.getGlyph(codePoint, 32, false);
+
+            const sf::Image image    = font.getTexture(32).copyToImage();
+            const sf::Image expected = reference.getTexture(32).copyToImage();
+            for (std::uint32_t codePoint = U'a'; codePoint <= U'z'; ++codePoint)
+            {
+                const sf::IntRect rect = font.getGlyph(codePoint, 32, false).textureRect;
+                REQUIRE(rect == reference.getGlyph(codePoint, 32, false).textureRect);
+                CHECK(haveSamePixels(image, rect, expected, rect));
+            }
+        }
+    }
+
+    SECTION("getAtlasStatistics()")
+    {
+        sf::Font font("Graphics/tuffy.ttf");
+
+        SECTION("No texture")
+        {
+            // The statistics don't create the texture
+            const sf::Font::AtlasStatistics statistics = font.getAtlasStatistics(32);
+            CHECK(statistics.textureSize == sf::Vector2u());
+            CHECK(statistics.glyphCount == 0);
+            CHECK(statistics.occupancy == 0);
+            CHECK(statistics.evictions == 0);
+            CHECK(statistics.regrowths == 0);
+        }
+
+        SECTION("Empty texture")
+        {
+            (void)font.getTexture(32);
+
+            const sf::Font::AtlasStatistics statistics = font.getAtlasStatistics(32);
+            CHECK(statistics.textureSize == sf::Vector2u(128, 128));
+            CHECK(statistics.glyphCount == 0);
+            CHECK(statistics.occupancy == 0);
+            CHECK(statistics.evictions == 0);
+            CHECK(statistics.regrowths == 0);
+        }
+
+        SECTION("Regrowth")
+        {
+            for (std::uint32_t codePoint = U'!'; codePoint <= U'~'; ++codePoint)
+                (void)font.getGlyph(codePoint, 32, false);
+
+            const sf::Font::AtlasStatistics statistics = font.getAtlasStatistics(32);
+            CHECK(statistics.textureSize.x > 128);
+            CHECK(statistics.glyphCount == 94);
+            CHECK(statistics.occupancy > 0);
+            CHECK(statistics.occupancy <= 1);
+            CHECK(statistics.evictions == 0);
+            CHECK(statistics.regrowths > 0);
+        }
+
+        SECTION("Eviction")
+        {
+            font.setMaximumTextureSize(128);
+
+            const sf::Glyph& first   = font.getGlyph(U'!', 32, false);
+            const float      advance = first.advance;
+            for (std::uint32_t codePoint = U'"'; codePoint <= U'~'; ++codePoint)
+                (void)font.getGlyph(codePoint, 32, false);
+
+            const sf::Font::AtlasStatistics statistics = font.getAtlasStatistics(32);
+            CHECK(statistics.textureSize == sf::Vector2u(128, 128));
+            CHECK(statistics.glyphCount < 94);
+            CHECK(statistics.evictions > 0);
+            CHECK(statistics.evictions + statistics.glyphCount == 94);
+            CHECK(statistics.regrowths == 0);
+
+            // The most recently loaded glyph is always kept
+            const sf::Glyph& glyph = font.getGlyph(U'~', 32, false);
+            CHECK(glyph.textureRect.size.x > 0);
+            CHECK(font.getAtlasStatistics(32).evictions == statistics.evictions);
+
+            // Evicted glyphs keep their entry, and are loaded again when requested
+            CHECK(first.advance == advance);
+            CHECK(&font.getGlyph(U'!', 32, false) == &first);
+            CHECK(first.textureRect.size.x > 0);
+        }
+
+        SECTION("Pixels of the glyphs kept by evictions")
+        {
+            // The first eviction reads the texture back, the following ones move the glyphs within that copy
+            font.setMaximumTextureSize(128);
+            const sf::Font                reference("Graphics/tuffy.ttf");
+            std::vector<const sf::Glyph*> glyphs;
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                glyphs.clear();
+                for (std::uint32_t codePoint = U'!'; codePoint <= U'~'; ++codePoint)
+                {
+                    glyphs.push_back(&font.getGlyph(codePoint, 32, false));
+                    (void)reference.getGlyph(codePoint, 32, false);
+                }
+            }
+            REQUIRE(font.getAtlasStatistics(32).evictions > 0);
+
+            // Requesting the glyphs again could evict others, compare the ones in the texture as they are
+            const sf::Image image    = font.getTexture(32).copyToImage();
+            const sf::Image expected = reference.getTexture(32).copyToImage();
+            for (std::uint32_t codePoint = U'!'; codePoint <= U'~'; ++codePoint)
+            {
+                const sf::IntRect rect = glyphs[codePoint - U'!']->textureRect;
+                if (rect.size.x > 0)
+                    CHECK(haveSamePixels(image, rect, expected, reference.getGlyph(codePoint, 32, false).textureRect));
+            }
+        }
+    }
 }
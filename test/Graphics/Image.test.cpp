@@ -5,10 +5,14 @@
 #include <SFML/System/FileInputStream.hpp>
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 
 #include <GraphicsUtil.hpp>
+#include <algorithm>
 #include <array>
+#include <functional>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Graphics] sf::Image")
 {
@@ -254,6 +258,73 @@ TEST_CASE("[Graphics] sf::Image")
                 }
             }
         }
+
+        SECTION("resize(Vector2, PixelBuffer)")
+        {
+            // 10 x 10, with 4 colour channels array, released through a counting deleter
+            static std::array<std::uint8_t, 400> pixels{};
+            for (std::size_t i = 0; i < pixels.size(); i += 4)
+            {
+                pixels[i]     = 255; // r
+                pixels[i + 1] = 0;   // g
+                pixels[i + 2] = 0;   // b
+                pixels[i + 3] = 255; // a
+            }
+
+            int releaseCount = 0;
+
+            sf::Image image;
+            image.resize(sf::Vector2u(10, 10),
+                         sf::Image::PixelBuffer(pixels.data(), [&releaseCount](std::uint8_t*) { ++releaseCount; }));
+
+            CHECK(image.getSize() == sf::Vector2u(10, 10));
+            CHECK(image.getPixelsPtr() == pixels.data());
+            CHECK(image.getPixel(sf::Vector2u(3, 7)) == sf::Color::Red);
+            CHECK(releaseCount == 0);
+
+            SECTION("Copy")
+            {
+                const sf::Image copy(image); // NOLINT(performance-unnecessary-copy-initialization)
+                CHECK(copy.getSize() == sf::Vector2u(10, 10));
+                CHECK(copy.getPixelsPtr() != pixels.data());
+                CHECK(copy.getPixel(sf::Vector2u(3, 7)) == sf::Color::Red);
+            }
+
+            SECTION("Resize")
+            {
+                image.resize(sf::Vector2u(10, 10), sf::Color::Blue);
+                CHECK(image.getPixelsPtr() == pixels.data());
+                CHECK(releaseCount == 0);
+
+                image.resize(sf::Vector2u(5, 5));
+                CHECK(image.getPixelsPtr() != pixels.data());
+                CHECK(releaseCount == 1);
+            }
+
+            SECTION("releasePixels()")
+            {
+                const sf::Image::PixelBuffer released = image.releasePixels();
+                CHECK(released.get() == pixels.data());
+                CHECK(image.getSize() == sf::Vector2u(0, 0));
+                CHECK(image.getPixelsPtr() == nullptr);
+                CHECK(releaseCount == 0);
+            }
+
+            image = sf::Image();
+            CHECK(releaseCount == 1);
+        }
+
+        SECTION("resize(Vector2, PixelBuffer) with the default deleter")
+        {
+            sf::Image image;
+            image.resize(sf::Vector2u(1, 1), sf::Image::PixelBuffer(new std::uint8_t[4]{1, 2, 3, 4}));
+            CHECK(image.getPixel(sf::Vector2u(0, 0)) == sf::Color(1, 2, 3, 4));
+
+            // An empty release function falls back to delete[] as well
+            const std::function<void(std::uint8_t*)> noFunction;
+            image.resize(sf::Vector2u(1, 1), sf::Image::PixelBuffer(new std::uint8_t[4]{5, 6, 7, 8}, noFunction));
+            CHECK(image.getPixel(sf::Vector2u(0, 0)) == sf::Color(5, 6, 7, 8));
+        }
     }
 
     SECTION("loadFromFile()")
@@ -609,6 +680,19 @@ TEST_CASE("[Graphics] sf::Image")
             }
         }
 
+        SECTION("Only matching pixels")
+        {
+            sf::Image image(sf::Vector2u(7, 3), sf::Color::Blue);
+            image.setPixel(sf::Vector2u(1, 0), sf::Color::Red);
+            image.setPixel(sf::Vector2u(6, 2), sf::Color(0, 0, 255, 254));
+            image.createMaskFromColor(sf::Color::Blue, 50);
+
+            CHECK(image.getPixel(sf::Vector2u(0, 0)) == sf::Color(0, 0, 255, 50));
+            CHECK(image.getPixel(sf::Vector2u(1, 0)) == sf::Color::Red);
+            CHECK(image.getPixel(sf::Vector2u(5, 2)) == sf::Color(0, 0, 255, 50));
+            CHECK(image.getPixel(sf::Vector2u(6, 2)) == sf::Color(0, 0, 255, 254));
+        }
+
         SECTION("createMaskFromColor(Color, std::uint8_t)")
         {
             sf::Image image(sf::Vector2u(10, 10), sf::Color::Blue);
@@ -631,6 +715,22 @@ TEST_CASE("[Graphics] sf::Image")
         image.flipHorizontally();
 
         CHECK(image.getPixel(sf::Vector2u(9, 0)) == sf::Color::Green);
+
+        SECTION("Odd width")
+        {
+            sf::Image oddImage(sf::Vector2u(13, 2));
+            for (std::uint8_t x = 0; x < 13; ++x)
+                for (std::uint8_t y = 0; y < 2; ++y)
+                    oddImage.setPixel(sf::Vector2u(x, y), sf::Color(x, y, 0, 255));
+            oddImage.flipHorizontally();
+
+            for (std::uint8_t x = 0; x < 13; ++x)
+            {
+                const auto flippedX = static_cast<std::uint8_t>(12 - x);
+                for (std::uint8_t y = 0; y < 2; ++y)
+                    CHECK(oddImage.getPixel(sf::Vector2u(x, y)) == sf::Color(flippedX, y, 0, 255));
+            }
+        }
     }
 
     SECTION("Flip vertically")
@@ -641,4 +741,79 @@ TEST_CASE("[Graphics] sf::Image")
 
         CHECK(image.getPixel(sf::Vector2u(0, 9)) == sf::Color::Green);
     }
+
+    SECTION("resample()")
+    {
+        const sf::Image image(sf::Vector2u(37, 23), sf::Color(10, 200, 90, 255));
+
+        SECTION("Empty size")
+        {
+            CHECK(image.resample(sf::Vector2u(0, 5)).getSize() == sf::Vector2u());
+            CHECK(sf::Image().resample(sf::Vector2u(5, 5)).getSize() == sf::Vector2u());
+        }
+
+        SECTION("Uniform color is preserved")
+        {
+            const auto filter = GENERATE(sf::Image::ResampleFilter::Box,
+                                         sf::Image::ResampleFilter::Bilinear,
+                                         sf::Image::ResampleFilter::Lanczos);
+            const auto sRgb   = GENERATE(false, true);
+
+            for (const sf::Vector2u size : {sf::Vector2u(5, 3), sf::Vector2u(100, 70), sf::Vector2u(1, 1)})
+            {
+                const sf::Image resampled = image.resample(size, filter, sRgb);
+                REQUIRE(resampled.getSize() == size);
+                for (unsigned int x = 0; x < size.x; ++x)
+                    for (unsigned int y = 0; y < size.y; ++y)
+                        CHECK(resampled.getPixel(sf::Vector2u(x, y)) == sf::Color(10, 200, 90, 255));
+            }
+        }
+
+        SECTION("Box filter averages pixels")
+        {
+            sf::Image checker(sf::Vector2u(4, 2));
+            for (unsigned int x = 0; x < 4; ++x)
+                for (unsigned int y = 0; y < 2; ++y)
+                    checker.setPixel(sf::Vector2u(x, y), (x + y) % 2 ? sf::Color::White : sf::Color::Black);
+
+            CHECK(checker.resample(sf::Vector2u(2, 1), sf::Image::ResampleFilter::Box).getPixel({0, 0}) ==
+                  sf::Color(128, 128, 128));
+            CHECK(checker.resample(sf::Vector2u(2, 1), sf::Image::ResampleFilter::Box, true).getPixel({0, 0}) ==
+                  sf::Color(188, 188, 188));
+        }
+
+        SECTION("Transparent pixels don't bleed")
+        {
+            sf::Image transparent(sf::Vector2u(2, 1));
+            transparent.setPixel(sf::Vector2u(0, 0), sf::Color(255, 0, 0, 255));
+            transparent.setPixel(sf::Vector2u(1, 0), sf::Color(0, 255, 0, 0));
+
+            CHECK(transparent.resample(sf::Vector2u(1, 1), sf::Image::ResampleFilter::Box).getPixel({0, 0}) ==
+                  sf::Color(255, 0, 0, 128));
+        }
+
+        SECTION("Multithreaded")
+        {
+            const sf::Image logo("Graphics/sfml-logo-big.png");
+            const sf::Image single = logo.resample(sf::Vector2u(300, 91), sf::Image::ResampleFilter::Lanczos, true, 1);
+            const sf::Image multi  = logo.resample(sf::Vector2u(300, 91), sf::Image::ResampleFilter::Lanczos, true, 4);
+            CHECK(std::equal(single.getPixelsPtr(), single.getPixelsPtr() + 300 * 91 * 4, multi.getPixelsPtr()));
+        }
+    }
+
+    SECTION("createMipmap()")
+    {
+        CHECK(sf::Image().createMipmap().empty());
+        CHECK(sf::Image(sf::Vector2u(1, 1), sf::Color::Red).createMipmap().empty());
+
+        const sf::Image              image(sf::Vector2u(37, 10), sf::Color::Blue);
+        const std::vector<sf::Image> levels = image.createMipmap();
+        REQUIRE(levels.size() == 5);
+        CHECK(levels[0].getSize() == sf::Vector2u(18, 5));
+        CHECK(levels[1].getSize() == sf::Vector2u(9, 2));
+        CHECK(levels[2].getSize() == sf::Vector2u(4, 1));
+        CHECK(levels[3].getSize() == sf::Vector2u(2, 1));
+        CHECK(levels[4].getSize() == sf::Vector2u(1, 1));
+        CHECK(levels[4].getPixel(sf::Vector2u(0, 0)) == sf::Color::Blue);
+    }
 }
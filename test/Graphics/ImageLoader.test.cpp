@@ -0,0 +1,105 @@
+#include <SFML/Graphics/ImageLoader.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <algorithm>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::ImageLoader")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::ImageLoader>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::ImageLoader>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::ImageLoader>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::ImageLoader>);
+    }
+
+    const std::vector<std::filesystem::path> filenames = {"Graphics/sfml-logo-big.png",
+                                                          "this/does/not/exist.jpg",
+                                                          "Graphics/sfml-logo-big.bmp",
+                                                          "Graphics/sfml-logo-big.jpg",
+                                                          "Graphics/sfml-logo-big.gif"};
+
+    SECTION("Empty list")
+    {
+        sf::ImageLoader loader({});
+        CHECK(loader.getCount() == 0);
+        CHECK(!loader.waitNext());
+        CHECK(loader.waitForImages().empty());
+    }
+
+    SECTION("waitForImages()")
+    {
+        const unsigned int threadCount = GENERATE(0u, 1u, 3u);
+
+        sf::ImageLoader loader(filenames, threadCount);
+        CHECK(loader.getCount() == 5);
+        CHECK(!loader.isCancelled());
+
+        const auto images = loader.waitForImages();
+        CHECK(loader.getProcessedCount() == 5);
+        REQUIRE(images.size() == 5);
+        REQUIRE(images[0]);
+        CHECK(images[0]->getPixel({0, 0}) == sf::Color(255, 255, 255, 0));
+        CHECK(!images[1]);
+        REQUIRE(images[2]);
+        CHECK(images[2]->getPixel({0, 0}) == sf::Color::White);
+        REQUIRE(images[3]);
+        CHECK(images[3]->getSize() == sf::Vector2u(1001, 304));
+        REQUIRE(images[4]);
+        CHECK(images[4]->getPixel({200, 150}) == sf::Color(146, 210, 62));
+        CHECK(!loader.waitNext());
+    }
+
+    SECTION("waitNext()")
+    {
+        sf::ImageLoader loader(filenames, 2);
+
+        std::vector<bool> returned(filenames.size());
+        while (const auto result = loader.waitNext())
+        {
+            REQUIRE(result->index < filenames.size());
+            CHECK(!returned[result->index]);
+            CHECK(result->image.has_value() == (result->index != 1));
+            returned[result->index] = true;
+        }
+
+        CHECK(returned == std::vector<bool>(filenames.size(), true));
+        CHECK(!loader.pollNext());
+    }
+
+    SECTION("cancel()")
+    {
+        sf::ImageLoader loader(filenames, 1);
+        loader.cancel();
+        CHECK(loader.isCancelled());
+        CHECK(!loader.waitNext());
+
+        const auto images = loader.waitForImages();
+        CHECK(images.size() == 5);
+        CHECK(std::none_of(images.begin(), images.end(), [](const auto& image) { return image.has_value(); }));
+    }
+}
+
+TEST_CASE("[Graphics] sf::ImageLoader textures", runDisplayTests())
+{
+    sf::ImageLoader loader({"Graphics/sfml-logo-big.png", "this/does/not/exist.jpg"});
+
+    std::size_t progressCount = 0;
+    const auto  textures      = loader.uploadTextures(false,
+                                                [&](std::size_t done, std::size_t count)
+                                                {
+                                                    CHECK(done == ++progressCount);
+                                                    CHECK(count == 2);
+                                                });
+
+    CHECK(progressCount == 2);
+    REQUIRE(textures.size() == 2);
+    REQUIRE(textures[0]);
+    CHECK(textures[0]->getSize() == sf::Vector2u(1001, 304));
+    CHECK(!textures[1]);
+}
@@ -61,6 +61,25 @@ TEST_CASE("[Graphics] sf::RenderTarget")
         CHECK(renderTarget.setActive(true));
     }
 
+    SECTION("Set/get batching enabled")
+    {
+        RenderTarget renderTarget;
+        CHECK(!renderTarget.isBatchingEnabled());
+        renderTarget.setBatchingEnabled(true);
+        CHECK(renderTarget.isBatchingEnabled());
+        renderTarget.setBatchingEnabled(false);
+        CHECK(!renderTarget.isBatchingEnabled());
+    }
+
+    SECTION("getBatchStatistics()")
+    {
+        const RenderTarget renderTarget;
+        CHECK(renderTarget.getBatchStatistics().drawCalls == 0);
+        CHECK(renderTarget.getBatchStatistics().mergedDraws == 0);
+        CHECK(renderTarget.getBatchStatistics().batches == 0);
+        CHECK(renderTarget.getBatchStatistics().vertices == 0);
+    }
+
     const auto makeView = [](const auto& viewport)
     {
         sf::View view;
@@ -1,13 +1,22 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
 #include <SFML/System/Exception.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <WindowUtil.hpp>
+#include <algorithm>
+#include <array>
 #include <type_traits>
 
+#include <cstddef>
+
 TEST_CASE("[Graphics] sf::RenderTexture", runDisplayTests())
 {
     SECTION("Type traits")
@@ -125,4 +134,95 @@ TEST_CASE("[Graphics] sf::RenderTexture", runDisplayTests())
         const sf::RenderTexture renderTexture({64, 64});
         CHECK(renderTexture.getTexture().getSize() == sf::Vector2u(64, 64));
     }
+
+    SECTION("Batching")
+    {
+        const sf::Texture texture(sf::Image({4, 4}, sf::Color::White));
+
+        sf::Sprite sprite(texture);
+        sprite.setScale({4, 4});
+
+        SECTION("Same pixels as without batching")
+        {
+            // Overlapping sprites (triangle strips) and rectangles (triangle fans with a strip for the outline)
+            const auto render = [&](bool batching)
+            {
+                sf::RenderTexture renderTexture({64, 64});
+                renderTexture.setBatchingEnabled(batching);
+                renderTexture.clear();
+
+                const std::array colors = {sf::Color::Red, sf::Color::Green, sf::Color::Blue};
+                for (std::size_t i = 0; i < colors.size(); ++i)
+                {
+                    sprite.setPosition({static_cast<float>(i) * 10, static_cast<float>(i) * 10});
+                    sprite.setColor(colors[i]);
+                    renderTexture.draw(sprite);
+                }
+
+                sf::RectangleShape rectangle({20, 10});
+                rectangle.setOutlineThickness(2);
+                rectangle.setOutlineColor(sf::Color::Yellow);
+                for (std::size_t i = 0; i < 2; ++i)
+                {
+                    rectangle.setPosition({8 + static_cast<float>(i) * 20, 8 + static_cast<float>(i) * 16});
+                    rectangle.setFillColor(colors[i + 1]);
+                    renderTexture.draw(rectangle);
+                }
+                renderTexture.display();
+
+                return renderTexture;
+            };
+
+            const sf::RenderTexture unbatched = render(false);
+            const sf::RenderTexture batched   = render(true);
+
+            const sf::Image   expected  = unbatched.getTexture().copyToImage();
+            const sf::Image   actual    = batched.getTexture().copyToImage();
+            const std::size_t byteCount = std::size_t{expected.getSize().x} * expected.getSize().y * 4;
+            CHECK(std::equal(expected.getPixelsPtr(), expected.getPixelsPtr() + byteCount, actual.getPixelsPtr()));
+
+            // One batch for the textured sprites, one for the untextured fills and outlines;
+            // strips and fans are split into independent triangles (2 per sprite, 4 per fill, 8 per outline)
+            const sf::RenderTarget::BatchStatistics& statistics = batched.getBatchStatistics();
+            CHECK(statistics.drawCalls == 7);
+            CHECK(statistics.mergedDraws == 5);
+            CHECK(statistics.batches == 2);
+            CHECK(statistics.vertices == 3 * 6 + 2 * (12 + 24));
+
+            // Nothing is collected without batching
+            CHECK(unbatched.getBatchStatistics().drawCalls == 0);
+        }
+
+        SECTION("State changes break the batch")
+        {
+            sf::RenderTexture renderTexture({64, 64});
+            renderTexture.setBatchingEnabled(true);
+            renderTexture.clear();
+            renderTexture.draw(sprite);
+            renderTexture.draw(sprite, sf::BlendAdd);
+            renderTexture.draw(sprite, sf::BlendAdd);
+            renderTexture.display();
+
+            CHECK(renderTexture.getBatchStatistics().drawCalls == 3);
+            CHECK(renderTexture.getBatchStatistics().mergedDraws == 1);
+            CHECK(renderTexture.getBatchStatistics().batches == 2);
+        }
+
+        SECTION("flush() breaks the batch")
+        {
+            sf::RenderTexture renderTexture({64, 64});
+            renderTexture.setBatchingEnabled(true);
+            renderTexture.clear();
+            renderTexture.draw(sprite);
+            renderTexture.flush();
+            renderTexture.draw(sprite);
+            renderTexture.draw(sprite);
+            renderTexture.display();
+
+            CHECK(renderTexture.getBatchStatistics().drawCalls == 3);
+            CHECK(renderTexture.getBatchStatistics().mergedDraws == 1);
+            CHECK(renderTexture.getBatchStatistics().batches == 2);
+            CHECK(renderTexture.getBatchStatistics().vertices == 3 * 6);
+        }
+    }
 }
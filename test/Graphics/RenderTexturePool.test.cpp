@@ -0,0 +1,133 @@
+#include <SFML/Graphics/RenderTexturePool.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <type_traits>
+#include <utility>
+
+TEST_CASE("[Graphics] sf::RenderTexturePool", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::RenderTexturePool>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::RenderTexturePool>);
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::RenderTexturePool::Lease>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::RenderTexturePool::Lease>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::RenderTexturePool::Lease>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::RenderTexturePool::Lease>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::RenderTexturePool pool;
+        CHECK(pool.getCount() == 0);
+        CHECK(pool.getIdleCount() == 0);
+        CHECK(pool.getGeneration() == 0);
+        CHECK(pool.getMaxIdleGenerations() == 2);
+    }
+
+    SECTION("acquire()")
+    {
+        sf::RenderTexturePool pool;
+        const sf::RenderTexture* first = nullptr;
+
+        {
+            const auto lease = pool.acquire({64, 32});
+            CHECK(lease->getSize() == sf::Vector2u(64, 32));
+            CHECK(pool.getCount() == 1);
+            CHECK(pool.getIdleCount() == 0);
+            first = &*lease;
+
+            // Leased render textures are never handed out twice
+            const auto other = pool.acquire({64, 32});
+            CHECK(&*other != first);
+            CHECK(pool.getCount() == 2);
+
+            lease->setSmooth(true);
+            lease->setRepeated(true);
+            lease->setBatchingEnabled(true);
+            lease->setView(sf::View(sf::FloatRect({10, 10}, {20, 20})));
+        }
+
+        CHECK(pool.getCount() == 2);
+        CHECK(pool.getIdleCount() == 2);
+
+        SECTION("Matching size and settings")
+        {
+            const auto lease = pool.acquire({64, 32});
+            CHECK(pool.getCount() == 2);
+            CHECK(pool.getIdleCount() == 1);
+            CHECK(!lease->isSmooth());
+            CHECK(!lease->isRepeated());
+            CHECK(!lease->isBatchingEnabled());
+            CHECK(lease->getView().getCenter() == lease->getDefaultView().getCenter());
+            CHECK(lease->getView().getSize() == lease->getDefaultView().getSize());
+        }
+
+        SECTION("Different size")
+        {
+            const auto lease = pool.acquire({32, 64});
+            CHECK(lease->getSize() == sf::Vector2u(32, 64));
+            CHECK(pool.getCount() == 3);
+            CHECK(pool.getIdleCount() == 2);
+        }
+
+        SECTION("Different settings")
+        {
+            const auto lease = pool.acquire({64, 32}, sf::ContextSettings{0 /* depthBits */, 8 /* stencilBits */});
+            CHECK(pool.getCount() == 3);
+            CHECK(pool.getIdleCount() == 2);
+        }
+
+        SECTION("Move")
+        {
+            auto lease      = pool.acquire({64, 32});
+            auto movedLease = std::move(lease);
+            CHECK(pool.getIdleCount() == 1);
+
+            movedLease = pool.acquire({64, 32});
+            CHECK(pool.getIdleCount() == 1);
+        }
+    }
+
+    SECTION("nextGeneration()")
+    {
+        sf::RenderTexturePool pool;
+        pool.setMaxIdleGenerations(1);
+        CHECK(pool.getMaxIdleGenerations() == 1);
+
+        const auto lease = pool.acquire({16, 16});
+        (void)pool.acquire({32, 32});
+        CHECK(pool.getCount() == 2);
+
+        pool.nextGeneration();
+        CHECK(pool.getGeneration() == 1);
+        CHECK(pool.getCount() == 2);
+
+        // Idle for more than one generation
+        pool.nextGeneration();
+        CHECK(pool.getGeneration() == 2);
+        CHECK(pool.getCount() == 1);
+
+        // Leased render textures are kept
+        pool.nextGeneration();
+        pool.nextGeneration();
+        CHECK(pool.getCount() == 1);
+    }
+
+    SECTION("clear()")
+    {
+        sf::RenderTexturePool pool;
+        const auto            lease = pool.acquire({16, 16});
+        (void)pool.acquire({32, 32});
+        CHECK(pool.getCount() == 2);
+
+        pool.clear();
+        CHECK(pool.getCount() == 1);
+        CHECK(pool.getIdleCount() == 0);
+    }
+}
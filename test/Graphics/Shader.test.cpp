@@ -1,11 +1,18 @@
 #include <SFML/Graphics/Shader.hpp>
 
 // Other 1st party headers
+#include <SFML/Window/Context.hpp>
+
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
 #include <type_traits>
 
 namespace
@@ -136,6 +143,30 @@ std::string skipShaderFullTests()
         return "";
 }
 
+#if defined(SFML_SYSTEM_WINDOWS)
+#define GLAPI __stdcall
+#else
+#define GLAPI
+#endif
+
+// Read the value of a vec2 uniform back from the program of a shader, with an active context
+std::array<float, 2> readVec2Uniform(const sf::Shader& shader, const char* name)
+{
+    using glGetUniformLocationFuncType = int(GLAPI*)(unsigned int, const char*);
+    using glGetUniformfvFuncType       = void(GLAPI*)(unsigned int, int, float*);
+    const auto glGetUniformLocationFunc = reinterpret_cast<glGetUniformLocationFuncType>(
+        sf::Context::getFunction("glGetUniformLocation"));
+    const auto glGetUniformfvFunc = reinterpret_cast<glGetUniformfvFuncType>(
+        sf::Context::getFunction("glGetUniformfv"));
+    REQUIRE(glGetUniformLocationFunc);
+    REQUIRE(glGetUniformfvFunc);
+
+    const unsigned int   program = shader.getNativeHandle();
+    std::array<float, 2> value{};
+    glGetUniformfvFunc(program, glGetUniformLocationFunc(program, name), value.data());
+    return value;
+}
+
 } // namespace
 
 TEST_CASE("[Graphics] sf::Shader (Dummy Implementation)", skipShaderDummyTests())
@@ -167,6 +198,17 @@ TEST_CASE("[Graphics] sf::Shader (Dummy Implementation)", skipShaderDummyTests()
         CHECK_FALSE(shader.loadFromMemory(vertexSource, fragmentSource));
         CHECK_FALSE(shader.loadFromMemory(vertexSource, geometrySource, fragmentSource));
     }
+
+    SECTION("getUniformHandle()")
+    {
+        sf::Shader shader;
+        CHECK(!shader.getUniformHandle("storm_position").isValid());
+    }
+
+    SECTION("Binary cache")
+    {
+        CHECK_FALSE(sf::Shader::isBinaryCacheAvailable());
+    }
 }
 
 TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
@@ -179,6 +221,12 @@ TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
         STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::Shader>);
     }
 
+    SECTION("UniformHandle")
+    {
+        STATIC_CHECK(!sf::Shader::UniformHandle().isValid());
+        STATIC_CHECK(std::is_trivially_copyable_v<sf::Shader::UniformHandle>);
+    }
+
     SECTION("Construction")
     {
         SECTION("Default constructor")
@@ -473,4 +521,84 @@ TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
             CHECK(static_cast<bool>(shader.getNativeHandle()) == sf::Shader::isGeometryAvailable());
         }
     }
+
+    SECTION("getUniformHandle()")
+    {
+        const sf::Context context;
+        sf::Shader        shader;
+        CHECK(!shader.getUniformHandle("storm_position").isValid());
+
+        REQUIRE(shader.loadFromMemory(vertexSource, sf::Shader::Type::Vertex) == sf::Shader::isAvailable());
+        const auto position = shader.getUniformHandle("storm_position");
+        const auto radius   = shader.getUniformHandle("storm_total_radius");
+        CHECK(position.isValid() == sf::Shader::isAvailable());
+        CHECK(radius.isValid() == sf::Shader::isAvailable());
+        CHECK(!shader.getUniformHandle("does_not_exist").isValid());
+
+        shader.setUniform(position, sf::Glsl::Vec2(1.f, 2.f));
+        shader.setUniform(position, sf::Glsl::Vec2(3.f, 4.f));
+        shader.setUniform(radius, 5.f);
+        shader.setUniform(sf::Shader::UniformHandle(), 6.f);
+        sf::Shader::bind(&shader);
+        sf::Shader::bind(nullptr);
+
+        // The last value assigned through the handle is uploaded when the shader is bound
+        if (sf::Shader::isAvailable())
+            CHECK(readVec2Uniform(shader, "storm_position") == std::array{3.f, 4.f});
+
+        SECTION("Reload")
+        {
+            // Handles created for the previous program are ignored, even if OpenGL reuses its name
+            REQUIRE(shader.loadFromMemory(vertexSource, sf::Shader::Type::Vertex) == sf::Shader::isAvailable());
+            shader.setUniform(position, sf::Glsl::Vec2(7.f, 8.f));
+            sf::Shader::bind(&shader);
+            sf::Shader::bind(nullptr);
+
+            if (sf::Shader::isAvailable())
+                CHECK(readVec2Uniform(shader, "storm_position") == std::array{0.f, 0.f});
+        }
+    }
+
+    SECTION("Binary cache")
+    {
+        // A directory of its own, so that concurrent runs of the test don't share cache entries
+        const auto directory = std::filesystem::temp_directory_path() /
+                               ("sfml-shader-binary-cache-" + std::to_string(std::random_device()()));
+        std::filesystem::remove_all(directory);
+        sf::Shader::setBinaryCacheDirectory(directory);
+
+        sf::Shader shader;
+        CHECK(shader.loadFromMemory(vertexSource, fragmentSource) == sf::Shader::isAvailable());
+        const bool cached = std::filesystem::exists(directory) && !std::filesystem::is_empty(directory);
+        CHECK(cached == sf::Shader::isBinaryCacheAvailable());
+
+        // Loading the same sources again restores the cached program
+        CHECK(shader.loadFromMemory(vertexSource, fragmentSource) == sf::Shader::isAvailable());
+        CHECK(shader.getUniformHandle("storm_position").isValid() == sf::Shader::isAvailable());
+
+        // Invalid entries fall back to compiling the sources
+        if (cached)
+        {
+            // Length in the header larger than the file
+            for (const auto& entry : std::filesystem::directory_iterator(directory))
+            {
+                std::fstream file(entry.path(), std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+                file.seekp(28);
+                file.write("\xFF\xFF\xFF\xFF", 4);
+            }
+
+            CHECK(shader.loadFromMemory(vertexSource, fragmentSource));
+            CHECK(shader.getUniformHandle("storm_position").isValid());
+
+            // Truncated header
+            for (const auto& entry : std::filesystem::directory_iterator(directory))
+                std::ofstream(entry.path(), std::ios_base::binary | std::ios_base::trunc) << "invalid";
+
+            CHECK(shader.loadFromMemory(vertexSource, fragmentSource));
+            CHECK(shader.getUniformHandle("storm_position").isValid());
+        }
+
+        sf::Shader::setBinaryCacheDirectory({});
+        std::filesystem::remove_all(directory);
+    }
 }
@@ -0,0 +1,168 @@
+#include <SFML/Graphics/SpriteBatch.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::SpriteBatch", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_constructible_v<sf::SpriteBatch, sf::Texture&&>);
+        STATIC_CHECK(!std::is_constructible_v<sf::SpriteBatch, const sf::Texture&&>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::SpriteBatch>);
+        STATIC_CHECK(!std::is_nothrow_move_constructible_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::SpriteBatch>);
+        STATIC_CHECK(!std::is_nothrow_move_assignable_v<sf::SpriteBatch>);
+    }
+
+    const sf::Texture texture(sf::Vector2u(64, 64));
+
+    SECTION("Construction")
+    {
+        const sf::SpriteBatch spriteBatch(texture);
+        CHECK(&spriteBatch.getTexture() == &texture);
+        CHECK(spriteBatch.getInstanceCount() == 0);
+        CHECK(spriteBatch.getLocalBounds() == sf::FloatRect());
+        CHECK(spriteBatch.getGlobalBounds() == sf::FloatRect());
+    }
+
+    SECTION("Set/get texture")
+    {
+        sf::SpriteBatch   spriteBatch(texture);
+        const sf::Texture otherTexture(sf::Vector2u(64, 64));
+        spriteBatch.setTexture(otherTexture);
+        CHECK(&spriteBatch.getTexture() == &otherTexture);
+    }
+
+    SECTION("append()")
+    {
+        sf::SpriteBatch spriteBatch(texture);
+        CHECK(spriteBatch.append({sf::Transform::Identity, {{0, 0}, {16, 16}}, sf::Color::Red}) == 0);
+        CHECK(spriteBatch.append({sf::Transform::Identity, {{16, 0}, {16, 16}}, sf::Color::Blue}) == 1);
+        CHECK(spriteBatch.getInstanceCount() == 2);
+        CHECK(spriteBatch.getInstance(0).textureRect == sf::IntRect({0, 0}, {16, 16}));
+        CHECK(spriteBatch.getInstance(0).color == sf::Color::Red);
+        CHECK(spriteBatch.getInstance(1).textureRect == sf::IntRect({16, 0}, {16, 16}));
+        CHECK(spriteBatch.getInstance(1).color == sf::Color::Blue);
+    }
+
+    SECTION("Set/get instance")
+    {
+        sf::SpriteBatch spriteBatch(texture);
+        spriteBatch.resize(3);
+        CHECK(spriteBatch.getInstanceCount() == 3);
+        CHECK(spriteBatch.getInstance(2).textureRect == sf::IntRect());
+        CHECK(spriteBatch.getInstance(2).color == sf::Color::White);
+
+        sf::Transform transform;
+        transform.translate({10, 20});
+        spriteBatch.setInstance(2, {transform, {{1, 2}, {3, 4}}, sf::Color::Green});
+        CHECK(spriteBatch.getInstance(2).transform == transform);
+        CHECK(spriteBatch.getInstance(2).textureRect == sf::IntRect({1, 2}, {3, 4}));
+        CHECK(spriteBatch.getInstance(2).color == sf::Color::Green);
+    }
+
+    SECTION("clear()")
+    {
+        sf::SpriteBatch spriteBatch(texture);
+        spriteBatch.resize(10);
+        spriteBatch.clear();
+        CHECK(spriteBatch.getInstanceCount() == 0);
+    }
+
+    SECTION("Set/get vertex buffer enabled")
+    {
+        sf::SpriteBatch spriteBatch(texture);
+        CHECK(spriteBatch.isVertexBufferEnabled());
+        spriteBatch.setVertexBufferEnabled(false);
+        CHECK(!spriteBatch.isVertexBufferEnabled());
+    }
+
+    SECTION("Rendering")
+    {
+        const sf::Texture whiteTexture(sf::Image({4, 4}, sf::Color::White));
+        sf::SpriteBatch   spriteBatch(whiteTexture);
+        sf::RenderTexture renderTexture({16, 8});
+
+        const auto render = [&]
+        {
+            renderTexture.clear();
+            renderTexture.draw(spriteBatch);
+            renderTexture.display();
+            return renderTexture.getTexture().copyToImage();
+        };
+
+        const auto at = [](float x, float y)
+        {
+            sf::Transform transform;
+            transform.translate({x, y});
+            return transform;
+        };
+
+        const auto drawAndModify = [&]
+        {
+            spriteBatch.append({at(0, 0), {{0, 0}, {4, 4}}, sf::Color::Red});
+            spriteBatch.append({at(8, 0), {{0, 0}, {4, 4}}, sf::Color::Green});
+
+            sf::Image image = render();
+            CHECK(image.getPixel({1, 1}) == sf::Color::Red);
+            CHECK(image.getPixel({9, 1}) == sf::Color::Green);
+            CHECK(image.getPixel({9, 5}) == sf::Color::Black);
+
+            // Only the modified instance is transferred again, the other one must be left as it was
+            spriteBatch.setInstance(1, {at(8, 4), {{0, 0}, {4, 4}}, sf::Color::Blue});
+            image = render();
+            CHECK(image.getPixel({1, 1}) == sf::Color::Red);
+            CHECK(image.getPixel({9, 1}) == sf::Color::Black);
+            CHECK(image.getPixel({9, 5}) == sf::Color::Blue);
+        };
+
+        SECTION("Vertex buffer")
+        {
+            drawAndModify();
+        }
+
+        SECTION("System memory")
+        {
+            spriteBatch.setVertexBufferEnabled(false);
+            drawAndModify();
+        }
+
+        SECTION("Vertex buffer enabled again")
+        {
+            drawAndModify();
+
+            // The instances modified while the vertex buffer was released are transferred when it is created again
+            spriteBatch.setVertexBufferEnabled(false);
+            spriteBatch.setInstance(0, {at(4, 4), {{0, 0}, {4, 4}}, sf::Color::Yellow});
+            spriteBatch.setVertexBufferEnabled(true);
+
+            const sf::Image image = render();
+            CHECK(image.getPixel({1, 1}) == sf::Color::Black);
+            CHECK(image.getPixel({5, 5}) == sf::Color::Yellow);
+            CHECK(image.getPixel({9, 5}) == sf::Color::Blue);
+        }
+    }
+
+    SECTION("Get bounds")
+    {
+        sf::SpriteBatch spriteBatch(texture);
+        sf::Transform   transform;
+        transform.translate({40, 50});
+        spriteBatch.append({sf::Transform::Identity, {{0, 0}, {10, 20}}});
+        spriteBatch.append({transform, {{0, 0}, {-10, -20}}});
+        CHECK(spriteBatch.getLocalBounds() == sf::FloatRect({0, 0}, {50, 70}));
+
+        spriteBatch.setPosition({5, 5});
+        CHECK(spriteBatch.getGlobalBounds() == sf::FloatRect({5, 5}, {50, 70}));
+    }
+}
@@ -2,13 +2,20 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
+#include <algorithm>
+#include <string>
+#include <thread>
 #include <type_traits>
 
+#include <cstdint>
+
 TEST_CASE("[Graphics] sf::Text", runDisplayTests())
 {
     SECTION("Type traits")
@@ -182,5 +189,166 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
             CHECK(text.getLocalBounds() == sf::FloatRect({1, 5}, {33, 13}));
             CHECK(text.getGlobalBounds() == Approx(sf::FloatRect({66, 182}, {33, 13})));
         }
+
+        SECTION("Append characters")
+        {
+            text.setStyle(sf::Text::Underlined | sf::Text::StrikeThrough);
+            text.setOutlineThickness(2);
+            CHECK(text.getLocalBounds() == sf::FloatRect({-1, 3}, {37, 17}));
+
+            // Appending resumes the layout, the result must match a text laid out at once
+            text.setString("Test\nLine");
+            text.setString("Test\nLine two");
+
+            sf::Text expected(font, "Test\nLine two", 18);
+            expected.setStyle(sf::Text::Underlined | sf::Text::StrikeThrough);
+            expected.setOutlineThickness(2);
+            CHECK(text.getLocalBounds() == expected.getLocalBounds());
+
+            text.setString("Test\nLine two, and three");
+            expected.setString("Test\nLine two, and three");
+            CHECK(text.getLocalBounds() == expected.getLocalBounds());
+
+            // Removing characters lays out the whole string again
+            text.setString("Test");
+            CHECK(text.getLocalBounds() == sf::FloatRect({-1, 3}, {37, 17}));
+        }
+    }
+
+    SECTION("Batched rendering")
+    {
+        // The glyphs don't all fit in the font texture, so glyphs are evicted and
+        // moved while the draws of the previous texts are still pending in the batch
+        const auto render = [](bool batching)
+        {
+            sf::Font smallFont("Graphics/tuffy.ttf");
+            smallFont.setMaximumTextureSize(128);
+
+            sf::RenderTexture renderTexture({256, 256});
+            renderTexture.setBatchingEnabled(batching);
+            renderTexture.clear();
+            for (std::uint32_t codePoint = U'!'; codePoint <= U'~'; ++codePoint)
+            {
+                const std::uint32_t index = codePoint - U'!';
+                sf::Text            text(smallFont, sf::String(static_cast<char32_t>(codePoint)), 32);
+                text.setPosition({static_cast<float>(index % 10 * 25), static_cast<float>(index / 10 * 25)});
+                renderTexture.draw(text);
+            }
+            renderTexture.display();
+            CHECK(smallFont.getAtlasStatistics(32).evictions > 0);
+
+            return renderTexture.getTexture().copyToImage();
+        };
+
+        const sf::Image batched   = render(true);
+        const sf::Image unbatched = render(false);
+        REQUIRE(batched.getSize() == unbatched.getSize());
+        const std::size_t byteCount = std::size_t{batched.getSize().x} * batched.getSize().y * 4;
+        CHECK(std::equal(batched.getPixelsPtr(), batched.getPixelsPtr() + byteCount, unbatched.getPixelsPtr()));
+    }
+
+    SECTION("Batched distance field outlines")
+    {
+        // Each outline thickness is drawn with its own threshold, while draws with other ones are still pending
+        const auto render = [](bool batching)
+        {
+            sf::Font distanceFieldFont("Graphics/tuffy.ttf");
+            distanceFieldFont.setDistanceFieldEnabled(true);
+
+            sf::RenderTexture renderTexture({256, 128});
+            renderTexture.setBatchingEnabled(batching);
+            renderTexture.clear();
+            for (int i = 0; i < 4; ++i)
+            {
+                sf::Text text(distanceFieldFont, "Hello", 24);
+                text.setOutlineThickness(static_cast<float>(i % 2 + 1));
+                text.setPosition({static_cast<float>(i % 2 * 128), static_cast<float>(i / 2 * 64)});
+                renderTexture.draw(text);
+            }
+            renderTexture.display();
+
+            return renderTexture.getTexture().copyToImage();
+        };
+
+        const sf::Image batched   = render(true);
+        const sf::Image unbatched = render(false);
+        REQUIRE(batched.getSize() == unbatched.getSize());
+        const std::size_t byteCount = std::size_t{batched.getSize().x} * batched.getSize().y * 4;
+        CHECK(std::equal(batched.getPixelsPtr(), batched.getPixelsPtr() + byteCount, unbatched.getPixelsPtr()));
+    }
+
+    SECTION("Glyphs stay in place while another thread has pending draws")
+    {
+        sf::Font smallFont("Graphics/tuffy.ttf");
+        smallFont.setMaximumTextureSize(128);
+
+        sf::RenderTexture renderTexture({64, 64});
+        renderTexture.setBatchingEnabled(true);
+        renderTexture.clear();
+        renderTexture.draw(sf::Text(smallFont, "Hello", 32));
+
+        // The draw pending in this thread can only be rendered here, so the glyphs it uses must not move
+        std::thread(
+            [&smallFont]
+            {
+                for (std::uint32_t codePoint = U'!'; codePoint <= U'~'; ++codePoint)
+                    (void)smallFont.getGlyph(codePoint, 32, false);
+            })
+            .join();
+        CHECK(smallFont.getAtlasStatistics(32).evictions == 0);
+        CHECK(smallFont.getTexture(32).getSize().x > 128);
+
+        renderTexture.display();
+        CHECK(renderTexture.getBatchStatistics().batches == 1);
+    }
+
+    SECTION("Layout while glyphs are evicted")
+    {
+        sf::Font smallFont("Graphics/tuffy.ttf");
+        smallFont.setMaximumTextureSize(128);
+        for (std::uint32_t codePoint = U'!'; codePoint <= U'~'; ++codePoint)
+            (void)smallFont.getGlyph(codePoint, 32, false);
+
+        // Loading the glyphs of the text evicts others, but never the ones it already loaded
+        const std::string string = "Hello, world";
+        const sf::Text    text(smallFont, string, 32);
+        (void)text.getLocalBounds();
+
+        const std::size_t evictions = smallFont.getAtlasStatistics(32).evictions;
+        for (const char character : string)
+        {
+            if (character != ' ')
+                CHECK(smallFont.getGlyph(static_cast<std::uint32_t>(character), 32, false).textureRect.size.x > 0);
+        }
+        CHECK(smallFont.getAtlasStatistics(32).evictions == evictions);
+    }
+
+    SECTION("More vertices than 16-bit indices can address")
+    {
+        // The 'B' is the first quad of the second chunk of 65536 vertices
+        const std::string glyphs(16384, 'A');
+        const auto        render = [&](bool split)
+        {
+            sf::RenderTexture renderTexture({64, 64});
+            renderTexture.clear();
+            if (split)
+            {
+                renderTexture.draw(sf::Text(font, glyphs, 16));
+                renderTexture.draw(sf::Text(font, "\n\nB", 16));
+            }
+            else
+            {
+                renderTexture.draw(sf::Text(font, glyphs + "\n\nB", 16));
+            }
+            renderTexture.display();
+
+            return renderTexture.getTexture().copyToImage();
+        };
+
+        const sf::Image whole = render(false);
+        const sf::Image split = render(true);
+        REQUIRE(whole.getSize() == split.getSize());
+        const std::size_t byteCount = std::size_t{whole.getSize().x} * whole.getSize().y * 4;
+        CHECK(std::equal(whole.getPixelsPtr(), whole.getPixelsPtr() + byteCount, split.getPixelsPtr()));
     }
 }
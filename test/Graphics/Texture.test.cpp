@@ -12,6 +12,7 @@
 #include <WindowUtil.hpp>
 #include <array>
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
 {
@@ -272,6 +273,70 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
         }
     }
 
+    SECTION("loadFromCompressedFile()")
+    {
+        sf::Texture texture(sf::Vector2u(2, 2));
+
+        SECTION("Invalid file")
+        {
+            CHECK(!texture.loadFromCompressedFile("Graphics/sfml-logo-big.png"));
+            CHECK(!texture.loadFromCompressedFile("does/not/exist.dds"));
+            CHECK(texture.getSize() == sf::Vector2u(2, 2));
+        }
+
+        SECTION("DDS")
+        {
+            REQUIRE(texture.loadFromCompressedFile("Graphics/checkerboard.dds"));
+            CHECK(texture.getSize() == sf::Vector2u(8, 8));
+            CHECK(!texture.isSrgb());
+
+            const sf::Image image = texture.copyToImage();
+            CHECK(image.getPixel(sf::Vector2u(0, 0)) == sf::Color::Red);
+            CHECK(image.getPixel(sf::Vector2u(7, 0)) == sf::Color::Green);
+            CHECK(image.getPixel(sf::Vector2u(0, 7)) == sf::Color::Blue);
+            CHECK(image.getPixel(sf::Vector2u(7, 7)) == sf::Color::White);
+        }
+
+        SECTION("KTX2")
+        {
+            REQUIRE(texture.loadFromCompressedFile("Graphics/checkerboard.ktx2"));
+            CHECK(texture.getSize() == sf::Vector2u(4, 2));
+
+            const sf::Image image = texture.copyToImage();
+            CHECK(image.getPixel(sf::Vector2u(0, 0)) == sf::Color::Red);
+            CHECK(image.getPixel(sf::Vector2u(3, 1)) == sf::Color::White);
+        }
+    }
+
+    SECTION("loadFromCompressedMemory()")
+    {
+        sf::Texture texture;
+        CHECK(!texture.loadFromCompressedMemory(nullptr, 0));
+
+        const auto memory = loadIntoMemory("Graphics/checkerboard.dds");
+        CHECK(!texture.loadFromCompressedMemory(memory.data(), memory.size() - 1));
+        REQUIRE(texture.loadFromCompressedMemory(memory.data(), memory.size()));
+        CHECK(texture.getSize() == sf::Vector2u(8, 8));
+        CHECK(texture.getNativeHandle() != 0);
+
+        // Sizes whose pixels can't be addressed are rejected before anything is computed from them
+        auto huge = memory;
+        for (std::size_t i = 12; i < 20; ++i)
+            huge[i] = std::byte{0xFF};
+        CHECK(!texture.loadFromCompressedMemory(huge.data(), huge.size()));
+        CHECK(texture.getSize() == sf::Vector2u(8, 8));
+    }
+
+    SECTION("loadFromCompressedStream()")
+    {
+        sf::Texture         texture;
+        sf::FileInputStream stream;
+        REQUIRE(stream.open("Graphics/checkerboard.ktx2"));
+        REQUIRE(texture.loadFromCompressedStream(stream));
+        CHECK(texture.getSize() == sf::Vector2u(4, 2));
+        CHECK(texture.getNativeHandle() != 0);
+    }
+
     SECTION("Copy semantics")
     {
         static constexpr std::array<std::uint8_t, 8> red = {0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF};
@@ -316,6 +381,22 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
             CHECK(texture.copyToImage().getPixel(sf::Vector2u(1, 0)) == sf::Color::Cyan);
         }
 
+        SECTION("Pixels, size, destination and stride")
+        {
+            // 3 x 2 source, the 2 x 2 region starting at its second column is uploaded
+            sf::Image image(sf::Vector2u(3, 2), sf::Color::Yellow);
+            image.setPixel(sf::Vector2u(2, 0), sf::Color::Cyan);
+            image.setPixel(sf::Vector2u(1, 1), sf::Color::Cyan);
+
+            sf::Texture texture(sf::Vector2u(3, 2));
+            texture.update(image.getPixelsPtr() + 4, sf::Vector2u(2, 2), sf::Vector2u(1, 0), 3);
+            const sf::Image result = texture.copyToImage();
+            CHECK(result.getPixel(sf::Vector2u(1, 0)) == sf::Color::Yellow);
+            CHECK(result.getPixel(sf::Vector2u(2, 0)) == sf::Color::Cyan);
+            CHECK(result.getPixel(sf::Vector2u(1, 1)) == sf::Color::Cyan);
+            CHECK(result.getPixel(sf::Vector2u(2, 1)) == sf::Color::Yellow);
+        }
+
         SECTION("Another texture")
         {
             sf::Texture otherTexture(sf::Vector2u(1, 1));
@@ -385,6 +466,20 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
         CHECK(texture.generateMipmap());
     }
 
+    SECTION("updateMipmap()")
+    {
+        sf::Texture     texture(sf::Vector2u(100, 50));
+        const sf::Image image(sf::Vector2u(100, 50), sf::Color::Red);
+
+        std::vector<sf::Image> levels = image.createMipmap();
+        CHECK(texture.updateMipmap(levels));
+
+        levels.pop_back();
+        CHECK(!texture.updateMipmap(levels));
+        CHECK(!texture.updateMipmap({}));
+        CHECK(!texture.updateMipmap(sf::Image(sf::Vector2u(50, 50), sf::Color::Red).createMipmap()));
+    }
+
     SECTION("swap()")
     {
         static constexpr std::array<std::uint8_t, 4> blue  = {0x00, 0x00, 0xFF, 0xFF};
@@ -0,0 +1,83 @@
+#include <SFML/Graphics/TextureReader.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::TextureReader", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TextureReader>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::TextureReader>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TextureReader>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TextureReader>);
+    }
+
+    SECTION("Construction")
+    {
+        sf::TextureReader reader;
+        CHECK(reader.getPendingCount() == 0);
+        CHECK(!reader.poll());
+        CHECK(!reader.wait());
+    }
+
+    SECTION("read()")
+    {
+        sf::TextureReader reader(2);
+
+        SECTION("Empty texture")
+        {
+            CHECK(!reader.read(sf::Texture()));
+            CHECK(reader.getPendingCount() == 0);
+        }
+
+        SECTION("Texture")
+        {
+            sf::Image image(sf::Vector2u(3, 2), sf::Color::Red);
+            image.setPixel(sf::Vector2u(2, 1), sf::Color::Blue);
+            const sf::Texture texture(image);
+
+            CHECK(reader.read(texture));
+            CHECK(reader.read(texture));
+            CHECK(!reader.read(texture));
+            CHECK(reader.getPendingCount() == 2);
+
+            for (int i = 0; i < 2; ++i)
+            {
+                const auto result = reader.wait();
+                REQUIRE(result);
+                CHECK(result->getSize() == sf::Vector2u(3, 2));
+                CHECK(result->getPixel(sf::Vector2u(0, 0)) == sf::Color::Red);
+                CHECK(result->getPixel(sf::Vector2u(2, 1)) == sf::Color::Blue);
+            }
+
+            CHECK(reader.getPendingCount() == 0);
+            CHECK(!reader.wait());
+        }
+
+        SECTION("Render texture")
+        {
+            sf::RenderTexture renderTexture({4, 4});
+            renderTexture.clear(sf::Color::Green);
+            sf::RectangleShape shape({4, 1});
+            shape.setFillColor(sf::Color::Yellow);
+            renderTexture.draw(shape);
+            renderTexture.display();
+
+            CHECK(reader.read(renderTexture.getTexture()));
+            const auto result = reader.wait();
+            REQUIRE(result);
+            CHECK(result->getSize() == sf::Vector2u(4, 4));
+            CHECK(result->getPixel(sf::Vector2u(1, 0)) == sf::Color::Yellow);
+            CHECK(result->getPixel(sf::Vector2u(1, 3)) == sf::Color::Green);
+        }
+    }
+}
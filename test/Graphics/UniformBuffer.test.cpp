@@ -0,0 +1,133 @@
+#include <SFML/Graphics/UniformBuffer.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Shader.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+// Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
+TEST_CASE("[Graphics] sf::UniformBuffer", "[.display]")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::UniformBuffer>);
+    }
+
+    // Skip tests if uniform buffers aren't available
+    if (!sf::UniformBuffer::isAvailable())
+        return;
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::UniformBuffer uniformBuffer;
+            CHECK(uniformBuffer.getSize() == 0);
+            CHECK(uniformBuffer.getNativeHandle() == 0);
+            CHECK(uniformBuffer.getUsage() == sf::UniformBuffer::Usage::Stream);
+        }
+
+        SECTION("Usage constructor")
+        {
+            const sf::UniformBuffer uniformBuffer(sf::UniformBuffer::Usage::Static);
+            CHECK(uniformBuffer.getSize() == 0);
+            CHECK(uniformBuffer.getNativeHandle() == 0);
+            CHECK(uniformBuffer.getUsage() == sf::UniformBuffer::Usage::Static);
+        }
+    }
+
+    SECTION("Move semantics")
+    {
+        sf::UniformBuffer uniformBuffer;
+        REQUIRE(uniformBuffer.create(64));
+        const unsigned int handle = uniformBuffer.getNativeHandle();
+
+        SECTION("Construction")
+        {
+            const sf::UniformBuffer movedUniformBuffer(std::move(uniformBuffer));
+            CHECK(movedUniformBuffer.getSize() == 64);
+            CHECK(movedUniformBuffer.getNativeHandle() == handle);
+        }
+
+        SECTION("Assignment")
+        {
+            sf::UniformBuffer movedUniformBuffer;
+            movedUniformBuffer = std::move(uniformBuffer);
+            CHECK(movedUniformBuffer.getSize() == 64);
+            CHECK(movedUniformBuffer.getNativeHandle() == handle);
+        }
+    }
+
+    SECTION("create()")
+    {
+        sf::UniformBuffer uniformBuffer;
+        CHECK(uniformBuffer.create(64));
+        CHECK(uniformBuffer.getSize() == 64);
+        CHECK(uniformBuffer.getNativeHandle() != 0);
+
+        CHECK(uniformBuffer.create(128));
+        CHECK(uniformBuffer.getSize() == 128);
+    }
+
+    SECTION("update()")
+    {
+        const std::array<float, 16> data{};
+        sf::UniformBuffer           uniformBuffer;
+        CHECK(!uniformBuffer.update(data.data(), sizeof(data)));
+
+        REQUIRE(uniformBuffer.create(sizeof(data)));
+        CHECK(uniformBuffer.update(data.data(), sizeof(data)));
+        CHECK(uniformBuffer.update(data.data(), sizeof(float), sizeof(float)));
+        CHECK(!uniformBuffer.update(nullptr, sizeof(data)));
+        CHECK(!uniformBuffer.update(data.data(), sizeof(data), sizeof(float)));
+        CHECK(!uniformBuffer.update(data.data(), sizeof(float), sizeof(data) + sizeof(float)));
+        CHECK(uniformBuffer.getSize() == sizeof(data));
+    }
+
+    SECTION("Set/get usage")
+    {
+        sf::UniformBuffer uniformBuffer;
+        uniformBuffer.setUsage(sf::UniformBuffer::Usage::Dynamic);
+        CHECK(uniformBuffer.getUsage() == sf::UniformBuffer::Usage::Dynamic);
+    }
+
+    SECTION("Shader::setUniformBlock()")
+    {
+        constexpr auto fragmentSource = R"(
+#version 140
+
+layout(std140) uniform Material
+{
+    vec4 color;
+};
+
+out vec4 fragColor;
+
+void main()
+{
+    fragColor = color;
+}
+)";
+
+        const std::array<float, 4> color{1.f, 0.5f, 0.25f, 1.f};
+        sf::UniformBuffer          uniformBuffer;
+        REQUIRE(uniformBuffer.create(sizeof(color)));
+        REQUIRE(uniformBuffer.update(color.data(), sizeof(color)));
+
+        // Uniform blocks require GLSL 1.40, which the context may not support
+        sf::Shader shader;
+        if (shader.loadFromMemory(fragmentSource, sf::Shader::Type::Fragment))
+        {
+            shader.setUniformBlock("Material", uniformBuffer);
+            sf::Shader::bind(&shader);
+            sf::Shader::bind(nullptr);
+        }
+    }
+}
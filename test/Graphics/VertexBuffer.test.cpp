@@ -1,14 +1,19 @@
 #include <SFML/Graphics/VertexBuffer.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
+#include <algorithm>
 #include <array>
 #include <type_traits>
 
+#include <cstddef>
+
 // Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
 TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
 {
@@ -134,6 +139,59 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
             CHECK(vertexBuffer.getVertexCount() == 128);
         }
 
+        SECTION("Partial updates")
+        {
+            SECTION("Stream usage")
+            {
+                vertexBuffer.setUsage(sf::VertexBuffer::Usage::Stream);
+            }
+
+            SECTION("Static usage")
+            {
+                vertexBuffer.setUsage(sf::VertexBuffer::Usage::Static);
+            }
+
+            CHECK(vertexBuffer.create(128));
+            CHECK(vertexBuffer.update(vertices.data(), 64, 32));
+            CHECK(vertexBuffer.update(vertices.data(), 0, 0));
+            CHECK(vertexBuffer.getVertexCount() == 128);
+
+            // One quad per pixel column, the partial update must only recolor the third one
+            const auto column = [](float x, sf::Color color)
+            {
+                return std::array<sf::Vertex, 6>{sf::Vertex{{x, 0}, color},
+                                                 sf::Vertex{{x + 1, 0}, color},
+                                                 sf::Vertex{{x, 1}, color},
+                                                 sf::Vertex{{x, 1}, color},
+                                                 sf::Vertex{{x + 1, 0}, color},
+                                                 sf::Vertex{{x + 1, 1}, color}};
+            };
+
+            std::array<sf::Vertex, 24> columns{};
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                const auto quad = column(static_cast<float>(i), sf::Color::Red);
+                std::copy(quad.begin(), quad.end(), columns.begin() + static_cast<std::ptrdiff_t>(i * 6));
+            }
+
+            vertexBuffer.setPrimitiveType(sf::PrimitiveType::Triangles);
+            CHECK(vertexBuffer.create(columns.size()));
+            CHECK(vertexBuffer.update(columns.data()));
+            CHECK(vertexBuffer.update(column(2, sf::Color::Green).data(), 6, 12));
+            CHECK(vertexBuffer.update(columns.data(), 0, 0));
+
+            sf::RenderTexture renderTexture({4, 1});
+            renderTexture.clear();
+            renderTexture.draw(vertexBuffer);
+            renderTexture.display();
+
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({0, 0}) == sf::Color::Red);
+            CHECK(image.getPixel({1, 0}) == sf::Color::Red);
+            CHECK(image.getPixel({2, 0}) == sf::Color::Green);
+            CHECK(image.getPixel({3, 0}) == sf::Color::Red);
+        }
+
         SECTION("Another buffer")
         {
             sf::VertexBuffer otherVertexBuffer;
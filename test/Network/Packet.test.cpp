@@ -10,7 +10,9 @@
 #include <type_traits>
 #include <vector>
 
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <cwchar>
 
 #define CHECK_PACKET_STREAM_OPERATORS(expected)              \
@@ -268,6 +270,159 @@ TEST_CASE("[Network] sf::Packet")
         }
     }
 
+    SECTION("reserve()")
+    {
+        sf::Packet packet;
+        packet.reserve(1024);
+        CHECK(packet.getDataSize() == 0);
+        CHECK(packet.endOfPacket());
+
+        packet.append(data.data(), data.size());
+        CHECK(packet.getDataSize() == data.size());
+    }
+
+    SECTION("read()/write()")
+    {
+        sf::Packet packet;
+
+        SECTION("Same encoding as stream operators")
+        {
+            // Long enough to go through the vectorized byte swap and its scalar tail
+            std::vector<std::int32_t> values(37);
+            for (std::size_t i = 0; i < values.size(); ++i)
+                values[i] = static_cast<std::int32_t>(i * 123'456'789) - 1'000'000;
+
+            sf::Packet expected;
+            for (const std::int32_t value : values)
+                expected << value;
+
+            packet.write(values.data(), values.size());
+            REQUIRE(packet.getDataSize() == expected.getDataSize());
+            const auto*       dataPtr         = static_cast<const std::byte*>(packet.getData());
+            const auto*       expectedDataPtr = static_cast<const std::byte*>(expected.getData());
+            const std::vector bytes(dataPtr, dataPtr + packet.getDataSize());
+            const std::vector expectedBytes(expectedDataPtr, expectedDataPtr + expected.getDataSize());
+            CHECK(bytes == expectedBytes);
+
+            std::vector<std::int32_t> received(values.size());
+            CHECK(packet.read(received.data(), received.size()));
+            CHECK(received == values);
+            CHECK(packet.endOfPacket());
+        }
+
+        SECTION("Round trip")
+        {
+            const std::array<std::uint16_t, 3> shorts{1, 2, 65'535};
+            const std::array<std::uint64_t, 2> longs{0x0102030405060708, 42};
+            const std::array<double, 2>        doubles{1.5, -789.123};
+            packet.write(shorts.data(), shorts.size()).write(longs.data(), longs.size());
+            packet.write(doubles.data(), doubles.size());
+            CHECK(packet.getDataSize() == sizeof(shorts) + sizeof(longs) + sizeof(doubles));
+
+            std::array<std::uint16_t, 3> receivedShorts{};
+            std::array<std::uint64_t, 2> receivedLongs{};
+            std::array<double, 2>        receivedDoubles{};
+            CHECK(packet.read(receivedShorts.data(), receivedShorts.size()));
+            CHECK(packet.read(receivedLongs.data(), receivedLongs.size()));
+            CHECK(packet.read(receivedDoubles.data(), receivedDoubles.size()));
+            CHECK(receivedShorts == shorts);
+            CHECK(receivedLongs == longs);
+            CHECK(receivedDoubles == doubles);
+            CHECK(packet.endOfPacket());
+        }
+
+        SECTION("Not enough data")
+        {
+            const std::array<std::int16_t, 2> values{1, 2};
+            packet.write(values.data(), values.size());
+
+            std::array<std::int16_t, 3> received{};
+            CHECK(!packet.read(received.data(), received.size()));
+            CHECK(packet.getReadPosition() == 0);
+        }
+    }
+
+    SECTION("Variable-length integers")
+    {
+        sf::Packet packet;
+
+        SECTION("Unsigned")
+        {
+            packet.writeVarUInt(0).writeVarUInt(127).writeVarUInt(300);
+            packet.writeVarUInt(std::numeric_limits<std::uint64_t>::max());
+            CHECK(packet.getDataSize() == 1 + 1 + 2 + 10);
+
+            std::uint64_t value = 0;
+            CHECK(packet.readVarUInt(value));
+            CHECK(value == 0);
+            CHECK(packet.readVarUInt(value));
+            CHECK(value == 127);
+            CHECK(packet.readVarUInt(value));
+            CHECK(value == 300);
+            CHECK(packet.readVarUInt(value));
+            CHECK(value == std::numeric_limits<std::uint64_t>::max());
+            CHECK(packet.endOfPacket());
+        }
+
+        SECTION("Signed")
+        {
+            packet.writeVarInt(-1).writeVarInt(63).writeVarInt(-64).writeVarInt(64);
+            packet.writeVarInt(std::numeric_limits<std::int64_t>::min());
+            CHECK(packet.getDataSize() == 1 + 1 + 1 + 2 + 10);
+
+            std::int64_t value = 0;
+            CHECK(packet.readVarInt(value));
+            CHECK(value == -1);
+            CHECK(packet.readVarInt(value));
+            CHECK(value == 63);
+            CHECK(packet.readVarInt(value));
+            CHECK(value == -64);
+            CHECK(packet.readVarInt(value));
+            CHECK(value == 64);
+            CHECK(packet.readVarInt(value));
+            CHECK(value == std::numeric_limits<std::int64_t>::min());
+            CHECK(packet.endOfPacket());
+        }
+
+        SECTION("Truncated")
+        {
+            packet << std::uint8_t{0x80};
+            std::uint64_t value = 0;
+            CHECK(!packet.readVarUInt(value));
+            CHECK(packet.getReadPosition() == 0);
+        }
+
+        SECTION("Overflow")
+        {
+            for (int i = 0; i < 9; ++i)
+                packet << std::uint8_t{0xFF};
+            packet << std::uint8_t{0x02};
+            std::uint64_t value = 0;
+            CHECK(!packet.readVarUInt(value));
+            CHECK(value == 0);
+            CHECK(packet.getReadPosition() == 0);
+        }
+    }
+
+    SECTION("Quantized floats")
+    {
+        sf::Packet packet;
+        packet.writeQuantized(-123.456f, -500.f, 500.f, 16);
+        packet.writeQuantized(1000.f, -500.f, 500.f, 12);
+        packet.writeQuantized(0.25f, 0.f, 1.f, 32);
+        CHECK(packet.getDataSize() == 2 + 2 + 4);
+
+        float value = 0;
+        CHECK(packet.readQuantized(value, -500.f, 500.f, 16));
+        CHECK(std::abs(value - -123.456f) <= 1000.f / 65'535.f);
+        CHECK(packet.readQuantized(value, -500.f, 500.f, 12));
+        CHECK(value == 500.f);
+        CHECK(packet.readQuantized(value, 0.f, 1.f, 32));
+        CHECK(value == 0.25f);
+        CHECK(packet.endOfPacket());
+        CHECK(!packet.readQuantized(value, 0.f, 1.f, 8));
+    }
+
     SECTION("onSend")
     {
         Packet      packet;
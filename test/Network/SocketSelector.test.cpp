@@ -1,11 +1,13 @@
 #include <SFML/Network/SocketSelector.hpp>
 
 // Other 1st party headers
+#include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/UdpSocket.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <type_traits>
+#include <vector>
 
 TEST_CASE("[Network] sf::SocketSelector")
 {
@@ -23,5 +25,51 @@ TEST_CASE("[Network] sf::SocketSelector")
     {
         const sf::SocketSelector socketSelector;
         CHECK(!socketSelector.isReady(socket));
+        CHECK(socketSelector.getReadySockets().empty());
+    }
+
+    SECTION("wait()")
+    {
+        sf::UdpSocket sender;
+        sf::UdpSocket receiver;
+        REQUIRE(socket.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::SocketSelector socketSelector;
+        socketSelector.add(socket);
+        socketSelector.add(receiver);
+        CHECK(!socketSelector.wait(sf::milliseconds(1)));
+        CHECK(socketSelector.getReadySockets().empty());
+
+        const char data[] = "ready";
+        REQUIRE(sender.send(data, sizeof(data), sf::IpAddress::LocalHost, receiver.getLocalPort()) ==
+                sf::Socket::Status::Done);
+
+        SECTION("Ready sockets")
+        {
+            REQUIRE(socketSelector.wait(sf::seconds(5)));
+            CHECK(socketSelector.isReady(receiver));
+            CHECK(!socketSelector.isReady(socket));
+            CHECK(!socketSelector.isReady(sender));
+            CHECK(socketSelector.getReadySockets() == std::vector<sf::Socket*>{&receiver});
+
+            const sf::SocketSelector copy(socketSelector); // NOLINT(performance-unnecessary-copy-initialization)
+            CHECK(copy.isReady(receiver));
+        }
+
+        SECTION("remove()")
+        {
+            socketSelector.remove(receiver);
+            CHECK(!socketSelector.wait(sf::milliseconds(1)));
+            CHECK(!socketSelector.isReady(receiver));
+        }
+
+        SECTION("clear()")
+        {
+            REQUIRE(socketSelector.wait(sf::seconds(5)));
+            socketSelector.clear();
+            CHECK(!socketSelector.isReady(receiver));
+            CHECK(socketSelector.getReadySockets().empty());
+        }
     }
 }
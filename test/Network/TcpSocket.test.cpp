@@ -2,10 +2,19 @@
 
 // Other 1st party headers
 #include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/SocketSelector.hpp>
+#include <SFML/Network/TcpListener.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
+
+#include <cstdint>
 
 TEST_CASE("[Network] sf::TcpSocket")
 {
@@ -24,4 +33,219 @@ TEST_CASE("[Network] sf::TcpSocket")
         CHECK(!tcpSocket.getRemoteAddress().has_value());
         CHECK(tcpSocket.getRemotePort() == 0);
     }
+
+    SECTION("send(Packet*, std::size_t, std::size_t&)")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        sf::TcpSocket sender;
+        REQUIRE(sender.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        sf::TcpSocket receiver;
+        REQUIRE(listener.accept(receiver) == sf::Socket::Status::Done);
+
+        SECTION("Blocking")
+        {
+            std::array<sf::Packet, 3> packets;
+            packets[0] << std::uint32_t{42};
+            packets[2] << "last" << 3.5f;
+
+            std::size_t sent = 0;
+            CHECK(sender.send(packets.data(), packets.size(), sent) == sf::Socket::Status::Done);
+            CHECK(sent == packets.size());
+
+            sf::Packet    packet;
+            std::uint32_t value = 0;
+            CHECK(receiver.receive(packet) == sf::Socket::Status::Done);
+            CHECK(packet >> value);
+            CHECK(value == 42);
+            CHECK(receiver.receive(packet) == sf::Socket::Status::Done);
+            CHECK(packet.getDataSize() == 0);
+            std::string text;
+            float       number = 0;
+            CHECK(receiver.receive(packet) == sf::Socket::Status::Done);
+            CHECK(packet >> text >> number);
+            CHECK(text == "last");
+            CHECK(number == 3.5f);
+        }
+
+        SECTION("Non-blocking resumption")
+        {
+            // Send more data than the socket buffers can hold, so that sends are partial
+            std::vector<sf::Packet> packets(200);
+            for (std::size_t i = 0; i < packets.size(); ++i)
+            {
+                const std::vector<std::uint8_t> payload(50'000 + i, static_cast<std::uint8_t>(i));
+                packets[i].append(payload.data(), payload.size());
+            }
+
+            std::size_t received = 0;
+            std::thread thread(
+                [&]
+                {
+                    sf::Packet packet;
+                    while ((received < packets.size()) && (receiver.receive(packet) == sf::Socket::Status::Done))
+                    {
+                        if (packet.getDataSize() != 50'000 + received ||
+                            static_cast<const std::uint8_t*>(packet.getData())[packet.getDataSize() - 1] !=
+                                static_cast<std::uint8_t>(received))
+                            break;
+                        ++received;
+                    }
+                });
+
+            // Retry with the packets which were not completely sent until everything is sent
+            sender.setBlocking(false);
+            std::size_t        first  = 0;
+            sf::Socket::Status status = sf::Socket::Status::NotReady;
+            while ((status == sf::Socket::Status::Partial) || (status == sf::Socket::Status::NotReady))
+            {
+                std::size_t sent = 0;
+                status           = sender.send(packets.data() + first, packets.size() - first, sent);
+                first += sent;
+            }
+            thread.join();
+
+            CHECK(status == sf::Socket::Status::Done);
+            CHECK(first == packets.size());
+            CHECK(received == packets.size());
+        }
+    }
+
+    SECTION("receive(Packet*, std::size_t, std::size_t&)")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        sf::TcpSocket sender;
+        REQUIRE(sender.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+        sf::TcpSocket receiver;
+        REQUIRE(listener.accept(receiver) == sf::Socket::Status::Done);
+        CHECK(!receiver.hasPendingPacket());
+
+        SECTION("Several packets")
+        {
+            std::array<sf::Packet, 5> packets;
+            for (std::size_t i = 0; i < packets.size(); ++i)
+                packets[i] << static_cast<std::uint32_t>(i);
+
+            std::size_t sent = 0;
+            REQUIRE(sender.send(packets.data(), packets.size(), sent) == sf::Socket::Status::Done);
+
+            // The packets may arrive over several wake-ups
+            std::array<sf::Packet, 5> receivedPackets;
+            std::size_t               total = 0;
+            while (total < receivedPackets.size())
+            {
+                std::size_t received = 0;
+                REQUIRE(receiver.receive(receivedPackets.data() + total, receivedPackets.size() - total, received) ==
+                        sf::Socket::Status::Done);
+                CHECK(received > 0);
+                total += received;
+            }
+
+            CHECK(!receiver.hasPendingPacket());
+            for (std::size_t i = 0; i < receivedPackets.size(); ++i)
+            {
+                std::uint32_t value = 0;
+                CHECK(receivedPackets[i] >> value);
+                CHECK(value == i);
+            }
+        }
+
+        SECTION("Large packet")
+        {
+            sf::Packet                      packet;
+            const std::vector<std::uint8_t> payload(1'000'000, 7);
+            packet.append(payload.data(), payload.size());
+
+            std::thread thread([&] { CHECK(sender.send(packet) == sf::Socket::Status::Done); });
+            sf::Packet  receivedPacket;
+            CHECK(receiver.receive(receivedPacket) == sf::Socket::Status::Done);
+            thread.join();
+
+            CHECK(receivedPacket.getDataSize() == payload.size());
+            CHECK(static_cast<const std::uint8_t*>(receivedPacket.getData())[payload.size() - 1] == 7);
+        }
+
+        SECTION("Raw data after a packet")
+        {
+            sf::Packet packet;
+            packet << std::uint32_t{1};
+            const char data[] = "raw";
+            REQUIRE(sender.send(packet) == sf::Socket::Status::Done);
+            REQUIRE(sender.send(data, sizeof(data)) == sf::Socket::Status::Done);
+
+            CHECK(receiver.receive(packet) == sf::Socket::Status::Done);
+
+            std::array<char, sizeof(data)> buffer{};
+            std::size_t                    total = 0;
+            while (total < buffer.size())
+            {
+                std::size_t received = 0;
+                REQUIRE(receiver.receive(buffer.data() + total, buffer.size() - total, received) ==
+                        sf::Socket::Status::Done);
+                total += received;
+            }
+            CHECK(std::string(buffer.data()) == "raw");
+        }
+
+        SECTION("Buffered packets reported by a selector")
+        {
+            std::array<sf::Packet, 2> packets;
+            packets[0] << std::uint32_t{1};
+            packets[1] << std::uint32_t{2};
+            std::size_t sent = 0;
+            REQUIRE(sender.send(packets.data(), packets.size(), sent) == sf::Socket::Status::Done);
+
+            sf::SocketSelector selector;
+            selector.add(receiver);
+            for (std::uint32_t expected = 1; expected <= 2; ++expected)
+            {
+                REQUIRE(selector.wait(sf::seconds(1)));
+                REQUIRE(selector.isReady(receiver));
+
+                sf::Packet    packet;
+                std::uint32_t value = 0;
+                REQUIRE(receiver.receive(packet) == sf::Socket::Status::Done);
+                CHECK(packet >> value);
+                CHECK(value == expected);
+            }
+
+            // Nothing is left in the buffer
+            CHECK(!selector.wait(sf::milliseconds(10)));
+        }
+
+        SECTION("Buffered packets of a moved socket")
+        {
+            std::array<sf::Packet, 2> packets;
+            std::size_t               sent = 0;
+            REQUIRE(sender.send(packets.data(), packets.size(), sent) == sf::Socket::Status::Done);
+
+            sf::SocketSelector selector;
+            selector.add(receiver);
+            REQUIRE(selector.wait(sf::seconds(1)));
+
+            sf::Packet packet;
+            REQUIRE(receiver.receive(packet) == sf::Socket::Status::Done);
+
+            // The buffered packet follows the socket
+            sf::TcpSocket moved(std::move(receiver));
+            selector.add(moved);
+            CHECK(selector.wait(sf::milliseconds(10)));
+            CHECK(selector.isReady(moved));
+
+            // Closing the socket forgets its buffered data
+            moved.disconnect();
+            CHECK(!selector.wait(sf::milliseconds(10)));
+        }
+
+        SECTION("Oversized packet")
+        {
+            // Only the size prefix is sent, declaring a packet far above the limit
+            const std::array<std::uint8_t, 4> header{0xFF, 0xFF, 0xFF, 0xFF};
+            REQUIRE(sender.send(header.data(), header.size()) == sf::Socket::Status::Done);
+
+            sf::Packet packet;
+            CHECK(receiver.receive(packet) == sf::Socket::Status::Error);
+        }
+    }
 }
@@ -2,7 +2,11 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
 #include <type_traits>
+#include <vector>
+
+#include <cstdint>
 
 TEST_CASE("[Network] sf::UdpSocket")
 {
@@ -35,4 +39,74 @@ TEST_CASE("[Network] sf::UdpSocket")
         udpSocket.unbind();
         CHECK(udpSocket.getLocalPort() == 0);
     }
+
+    SECTION("Batched send()/receive()")
+    {
+        sf::UdpSocket sender;
+        sf::UdpSocket receiver;
+        REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        std::size_t sent     = 0;
+        std::size_t received = 0;
+
+        SECTION("Invalid parameters")
+        {
+            const std::vector<std::byte>          tooLarge(sf::UdpSocket::MaxDatagramSize + 1);
+            const sf::UdpSocket::OutgoingDatagram datagram{tooLarge.data(),
+                                                           tooLarge.size(),
+                                                           sf::IpAddress::LocalHost,
+                                                           receiver.getLocalPort()};
+            CHECK(sender.send(&datagram, 1, sent) == sf::Socket::Status::Error);
+            CHECK(sent == 0);
+            CHECK(sender.send(nullptr, 0, sent) == sf::Socket::Status::Error);
+            CHECK(receiver.receive(nullptr, 0, received) == sf::Socket::Status::Error);
+            CHECK(received == 0);
+        }
+
+        SECTION("Round trip")
+        {
+            // More datagrams than the system takes in a single call
+            constexpr std::size_t                              count = 100;
+            std::array<std::uint8_t, count>                    payloads{};
+            std::array<sf::UdpSocket::OutgoingDatagram, count> outgoing{};
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                payloads[i] = static_cast<std::uint8_t>(i);
+                outgoing[i] = {&payloads[i], 1, sf::IpAddress::LocalHost, receiver.getLocalPort()};
+            }
+
+            CHECK(sender.send(outgoing.data(), outgoing.size(), sent) == sf::Socket::Status::Done);
+            CHECK(sent == count);
+
+            // The datagrams may be received over several calls
+            std::array<std::array<std::uint8_t, 16>, count>    buffers{};
+            std::array<sf::UdpSocket::IncomingDatagram, count> incoming{};
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                incoming[i].data = buffers[i].data();
+                incoming[i].size = buffers[i].size();
+            }
+
+            std::size_t total = 0;
+            while (total < count)
+            {
+                REQUIRE(receiver.receive(incoming.data() + total, count - total, received) == sf::Socket::Status::Done);
+                CHECK(received > 0);
+                total += received;
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                CHECK(incoming[i].received == 1);
+                CHECK(buffers[i][0] == i);
+                CHECK(incoming[i].remoteAddress == sf::IpAddress::LocalHost);
+                CHECK(incoming[i].remotePort == sender.getLocalPort());
+            }
+
+            // Nothing is left to receive
+            receiver.setBlocking(false);
+            CHECK(receiver.receive(incoming.data(), count, received) == sf::Socket::Status::NotReady);
+            CHECK(received == 0);
+        }
+    }
 }